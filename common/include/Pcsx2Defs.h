@@ -273,4 +273,18 @@ static const int __pagesize	= PCSX2_PAGESIZE;
 #define __fi	__forceinline
 #define __fc	__fastcall
 
+// --------------------------------------------------------------------------------------
+// __avx2 -- compiles a single function with AVX2 enabled.
+// --------------------------------------------------------------------------------------
+// Lets AVX2 kernels live in translation units built for the baseline ISA, so inline code
+// pulled in from shared headers is never emitted as AVX2.  Such functions (and any inline
+// helper using AVX2 intrinsics) must only be entered when x86caps.hasAVX2 is set.  MSVC
+// accepts AVX2 intrinsics in any function and needs no attribute.
+//
+#ifdef _MSC_VER
+#	define __avx2
+#else
+#	define __avx2	__attribute__((target("avx2")))
+#endif
+
 #endif
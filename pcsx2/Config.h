@@ -232,7 +232,8 @@ struct Pcsx2Config
 				PreBlockCheckEE	:1,
 				PreBlockCheckIOP:1;
 			bool
-				EnableEECache   :1;
+				EnableEECache   :1,
+				EnableEEBlockHints:1;
 		BITFIELD_END
 
 		RecompilerOptions();
@@ -21,6 +21,7 @@
 #include "Gif_Unit.h"
 #include "Vif.h"
 #include "Vif_Dma.h"
+#include "MTVU.h"
 #include "IPU/IPU.h"
 #include "IPU/IPU_Fifo.h"
 
@@ -107,6 +108,7 @@ void __fastcall WriteFIFO_VIF1(const mem128_t *value)
 	vif1ch.qwc += 1;
 
 	bool ret = VIF1transfer((u32*)value, 4);
+	if (THREAD_VU1) vu1Thread.Flush(); // FIFO writes have no end of transfer to publish at
 
 	if (vif1.cmd) {
 		if (vif1.done && !vif1ch.qwc) vif1Regs.stat.VPS = VPS_WAITING;
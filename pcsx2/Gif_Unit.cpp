@@ -21,7 +21,9 @@
 #include "Vif_Dma.h"
 #include "MTVU.h"
 
+Gif_MTVU_Queue gifMTVUQueue; // Before gifUnit, whose Reset() uses it
 Gif_Unit gifUnit;
+Gif_PathStats gifPathStats[3];
 
 // Returns true on stalling SIGNAL
 bool Gif_HandlerAD(u8* pMem) {
@@ -111,6 +113,7 @@ void Gif_AddGSPacketMTVU(GS_Packet& gsPack, GIF_PATH path) {
 void Gif_AddCompletedGSPacket(GS_Packet& gsPack, GIF_PATH path) {
 	//DevCon.WriteLn("Adding Completed Gif Packet [size=%x]", gsPack.size);
 	if (COPY_GS_PACKET_TO_MTGS) {
+		gifPathStats[path].copiedToMTGS += gsPack.size;
 		GetMTGS().PrepDataPacket(path, gsPack.size/16);
 		MemCopy_WrappedDest((u128*)&gifUnit.gifPath[path].buffer[gsPack.offset], RingBuffer.m_Ring, 
 							GetMTGS().m_packet_writepos, RingBufferSize, gsPack.size/16);
@@ -119,6 +122,7 @@ void Gif_AddCompletedGSPacket(GS_Packet& gsPack, GIF_PATH path) {
 	else {
 		pxAssertDev(!gsPack.readAmount, "Gif Unit - gsPack.readAmount only valid for MTVU path 1!");
 		gifUnit.gifPath[path].readAmount.fetch_add(gsPack.size);
+		gifPathStats[path].forwarded += gsPack.size;
 		GetMTGS().SendSimpleGSPacket(GS_RINGTYPE_GSPACKET,  gsPack.offset, gsPack.size, path);
 	}
 }
@@ -144,12 +144,103 @@ static __fi void incTag(u32& offset, u32& size, u32 incAmount) {
 	offset += incAmount;
 }
 
+// Per-path counters of how many bytes of GS packet data were moved and how.  These live
+// outside Gif_Path because Gif_Path is frozen into savestates as raw memory.  They are only
+// written by the thread feeding the path (EE, or MTVU for path 1) and read racily for logs.
+struct Gif_PathStats {
+	u64 copied;       // Guest memory -> path buffer (CopyGSPacketData)
+	u64 realigned;    // Moved back to the start of the path buffer (RealignPacket)
+	u64 forwarded;    // Handed to MTGS by reference into the path buffer (no copy)
+	u64 copiedToMTGS; // Copied into the MTGS ringbuffer (COPY_GS_PACKET_TO_MTGS)
+
+	// MTVU xgkick packet queue (path 1 only)
+	u64 queuePushes;    // Packets queued by FinishGSPacketMTVU
+	u64 queuePending;   // Sum of packets already pending at each push (/queuePushes = avg)
+	u64 queueOverflows; // Packets that found the ring full and went to the overflow list
+	u32 queueMaxPending;
+	void Reset() { memzero(*this); }
+};
+
+extern Gif_PathStats gifPathStats[3];
+
+// VU1 programs' XGkick(s) are queued by the MTVU thread (FinishGSPacketMTVU) and drained
+// by the MTGS thread (Get/PopGSPacketMTVU).  Normally they go through a fixed single-
+// producer/single-consumer ring where each side only writes its own position.
+//
+// The VU thread must never wait on MTGS for a slot: MTGS may be waiting on the EE
+// (GS_RINGTYPE_MTVU_GSPACKET needs CanDoGif), which may in turn be waiting on VU1.  So when
+// the ring is full, packets spill to a locked overflow list instead.  Once anything has
+// spilled, later packets follow it there until MTGS drains the list.  MTGS always takes
+// from the ring first, so packets are still consumed in order.
+//
+// Only path 1 uses this, so it lives outside Gif_Path (and out of savestates).
+struct Gif_MTVU_Queue {
+	static const u32 RingSize = 4096; // Must be a power of 2
+
+	std::atomic<u32> writePos;      // Written by MTVU thread
+	std::atomic<u32> readPos;       // Written by MTGS thread
+	std::atomic<u32> overflowCount; // overflow.size(), only changed under overflowMutex
+	Mutex overflowMutex;
+	std::deque<GS_Packet> overflow;
+	GS_Packet ring[RingSize];
+
+	Gif_MTVU_Queue() { Reset(); }
+	void Reset() {
+		ScopedLock lock(overflowMutex);
+		overflow.clear();
+		overflowCount = 0;
+		writePos = 0;
+		readPos  = 0;
+	}
+
+	u32 RingPending() const { return writePos.load(std::memory_order_acquire) - readPos.load(std::memory_order_acquire); }
+	u32 Pending()     const { return RingPending() + overflowCount.load(std::memory_order_acquire); }
+
+	// MTVU thread; returns false if the packet went to the overflow list
+	bool Push(const GS_Packet& gsPack) {
+		if (!overflowCount.load(std::memory_order_acquire) && RingPending() < RingSize) {
+			const u32 pos = writePos.load(std::memory_order_relaxed);
+			ring[pos & (RingSize-1)] = gsPack;
+			writePos.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+		ScopedLock lock(overflowMutex);
+		overflow.push_back(gsPack);
+		overflowCount.fetch_add(1, std::memory_order_release);
+		return false;
+	}
+
+	// MTGS thread; the packet stays queued until Pop()
+	bool Front(GS_Packet& gsPack) {
+		if (RingPending()) {
+			gsPack = ring[readPos.load(std::memory_order_relaxed) & (RingSize-1)];
+			return true;
+		}
+		ScopedLock lock(overflowMutex);
+		if (overflow.empty()) return false;
+		gsPack = overflow.front();
+		return true;
+	}
+
+	// MTGS thread
+	void Pop() {
+		if (RingPending()) {
+			readPos.fetch_add(1, std::memory_order_release);
+			return;
+		}
+		ScopedLock lock(overflowMutex);
+		if (overflow.empty()) return;
+		overflow.pop_front();
+		overflowCount.fetch_sub(1, std::memory_order_release);
+	}
+};
+
+extern Gif_MTVU_Queue gifMTVUQueue;
+
 struct Gif_Path_MTVU {
 	u32   fakePackets; // Fake packets pending to be sent to MTGS
-	Mutex gsPackMutex; // Used for atomic access to gsPackQueue
-	std::deque<GS_Packet> gsPackQueue; // VU1 programs' XGkick(s)
 	Gif_Path_MTVU() { Reset(); }
-	void Reset()    { fakePackets = 0; gsPackQueue.clear(); }
+	void Reset()    { fakePackets = 0; }
 };
 
 struct Gif_Path {
@@ -227,6 +318,7 @@ struct Gif_Path {
 			else Gif_AddBlankGSPacket(buffLimit - offset, idx);
 		}
 		//DevCon.WriteLn("Realign Packet [%d]", curSize - offset);
+		gifPathStats[idx].realigned += curSize - offset;
 		if (intersect) memmove(buffer, &buffer[offset], curSize - offset);
 		else       memcpy(buffer, &buffer[offset], curSize - offset);
 		curSize      -= offset;
@@ -249,6 +341,7 @@ struct Gif_Path {
 		pxAssertDev(curSize+size<=buffSize, "Gif Path Buffer Overflow!");
 		memcpy (&buffer[curSize], pMem, size);
 		curSize     += size;
+		gifPathStats[idx].copied += size;
 	}
 
 	// If completed a GS packet (with EOP) then returned GS_Packet.done = 1
@@ -378,20 +471,24 @@ struct Gif_Path {
 
 	// MTVU: Gets called after VU1 execution on MTVU thread
 	void FinishGSPacketMTVU() {
-		if (1) {
-			ScopedLock lock(mtvu.gsPackMutex);
-			readAmount.fetch_add(gsPack.size + gsPack.readAmount);
-			mtvu.gsPackQueue.push_back(gsPack);
-		}
+		Gif_PathStats& stats = gifPathStats[idx];
+		const u32 pending = gifMTVUQueue.Pending();
+		stats.queuePushes++;
+		stats.queuePending   += pending;
+		stats.queueMaxPending = std::max(stats.queueMaxPending, pending + 1);
+
+		readAmount.fetch_add(gsPack.size + gsPack.readAmount);
+		if (!gifMTVUQueue.Push(gsPack))
+			stats.queueOverflows++;
+		stats.forwarded += gsPack.size;
 		gsPack.Reset();
 		gsPack.offset = curOffset;
 	}
 
 	// MTVU: Gets called by MTGS thread
 	GS_Packet GetGSPacketMTVU() {
-		ScopedLock lock(mtvu.gsPackMutex);
-		if (mtvu.gsPackQueue.size()) {
-			GS_Packet t = mtvu.gsPackQueue[0];
+		GS_Packet t;
+		if (gifMTVUQueue.Front(t)) {
 			return t; // XGkick GS packet(s)
 		}
 		Console.Error("MTVU: Expected gsPackQueue to have elements!");
@@ -401,18 +498,13 @@ struct Gif_Path {
 
 	// MTVU: Gets called by MTGS thread
 	void PopGSPacketMTVU() {
-		ScopedLock lock(mtvu.gsPackMutex);
-		if (mtvu.gsPackQueue.size()) {
-			mtvu.gsPackQueue.pop_front();
-		}
+		gifMTVUQueue.Pop();
 	}
 
 	// MTVU: Returns the amount of pending
 	// GS Packets that MTGS hasn't yet processed
 	u32 GetPendingGSPackets() {
-		ScopedLock lock(mtvu.gsPackMutex);
-		u32 t = mtvu.gsPackQueue.size();
-		return t;
+		return idx == GIF_PATH_1 ? gifMTVUQueue.Pending() : 0;
 	}
 };
 
@@ -440,6 +532,10 @@ struct Gif_Unit {
 		gifPath[2].Reset(softReset);
 		if(!softReset) {
 			lastTranType = GIF_TRANS_INVALID;
+			gifMTVUQueue.Reset();
+			gifPathStats[0].Reset();
+			gifPathStats[1].Reset();
+			gifPathStats[2].Reset();
 		}
 	}
 
@@ -677,6 +773,14 @@ struct Gif_Unit {
 	void PrintPathInfo(GIF_PATH path) {
 		GUNIT_LOG("Gif Path %d - [hasData = %d][state = %d]", path,
 			       gifPath[path].hasDataRemaining(), gifPath[path].state);
+		GUNIT_LOG("Gif Path %d - [copied = %llu][realigned = %llu][forwarded = %llu][copiedToMTGS = %llu]", path,
+			       (unsigned long long)gifPathStats[path].copied,    (unsigned long long)gifPathStats[path].realigned,
+			       (unsigned long long)gifPathStats[path].forwarded, (unsigned long long)gifPathStats[path].copiedToMTGS);
+		if (path == GIF_PATH_1)
+			GUNIT_LOG("Gif Path %d - MTVU queue [pushes = %llu][avgPending = %llu][maxPending = %d][overflows = %llu]", path,
+			       (unsigned long long)gifPathStats[path].queuePushes,
+			       (unsigned long long)(gifPathStats[path].queuePending / std::max<u64>(gifPathStats[path].queuePushes, 1)),
+			       gifPathStats[path].queueMaxPending, (unsigned long long)gifPathStats[path].queueOverflows);
 	}
 };
 
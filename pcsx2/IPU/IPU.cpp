@@ -79,6 +79,12 @@ void ipuReset()
 
 	ipu_fifo.init();
 	ipu_cmd.clear();
+
+	// Pick the IPU kernels for the host; the AVX2 ones are bit-identical to the SSE2/C ones.
+	yuv2rgb = x86caps.hasAVX2 ? yuv2rgb_avx2 : yuv2rgb_sse2;
+	mpeg2_idct_copy = x86caps.hasAVX2 ? mpeg2_idct_copy_avx2 : mpeg2_idct_copy_c;
+	mpeg2_idct_add = x86caps.hasAVX2 ? mpeg2_idct_add_avx2 : mpeg2_idct_add_c;
+	ipu_dither = x86caps.hasAVX2 ? ipu_dither_avx2 : ipu_dither_c;
 }
 
 void ReportIPU()
@@ -350,6 +356,12 @@ static void ipuBCLR(u32 val)
 	IPU_LOG("Clear IPU input FIFO. Set Bit offset=0x%X", g_BP.BP);
 }
 
+// Note: IDEC/BDEC output is not cached for replay (e.g. looping menu FMVs).  The input a
+// command consumes is a bit count only known once the VLCs have been parsed, which is most
+// of the decode; the FIFO contents at command start depend on DMA timing, so they make a
+// poor key.  A replay would also have to restore everything the decode touches (DC
+// predictors, quantizer scale, g_BP, ipu_cmd progress, CTRL flags) and re-split the output
+// to match IPU0 DMA.  Loops longer than the cache would miss on every macroblock.
 static __ri void ipuIDEC(tIPU_CMD_IDEC idec)
 {
 	idec.log();
@@ -670,7 +682,7 @@ __fi void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn)
 	}
 }
 
-__fi void ipu_dither(const macroblock_rgb32& rgb32, macroblock_rgb16& rgb16, int dte)
+void ipu_dither_c(const macroblock_rgb32& rgb32, macroblock_rgb16& rgb16, int dte)
 {
 	int i, j;
 	for (i = 0; i < 16; ++i)
@@ -685,6 +697,8 @@ __fi void ipu_dither(const macroblock_rgb32& rgb32, macroblock_rgb16& rgb16, int
 	}
 }
 
+void (*ipu_dither)(const macroblock_rgb32& rgb32, macroblock_rgb16& rgb16, int dte) = ipu_dither_c;
+
 __fi void ipu_vq(macroblock_rgb16& rgb16, u8* indx4)
 {
 	Console.Error("IPU: VQ not implemented");
@@ -695,32 +709,6 @@ __fi void ipu_vq(macroblock_rgb16& rgb16, u8* indx4)
 //  Buffer reader
 // --------------------------------------------------------------------------------------
 
-__ri u32 UBITS(uint bits)
-{
-	uint readpos8 = g_BP.BP/8;
-
-	uint result = BigEndian(*(u32*)( (u8*)g_BP.internal_qwc + readpos8 ));
-	uint bp7 = (g_BP.BP & 7);
-	result <<= bp7;
-	result >>= (32 - bits);
-
-	return result;
-}
-
-__ri s32 SBITS(uint bits)
-{
-	// Read an unaligned 32 bit value and then shift the bits up and then back down.
-
-	uint readpos8 = g_BP.BP/8;
-
-	int result = BigEndian(*(s32*)( (s8*)g_BP.internal_qwc + readpos8 ));
-	uint bp7 = (g_BP.BP & 7);
-	result <<= bp7;
-	result >>= (32 - bits);
-
-	return result;
-}
-
 // whenever reading fractions of bytes. The low bits always come from the next byte
 // while the high bits come from the current byte
 u8 getBits64(u8 *address, bool advance)
@@ -896,6 +884,13 @@ __fi void IPUCMD_WRITE(u32 val)
 	//if(!ipu1ch.chcr.STR) hwIntcIrq(INTC_IPU);
 }
 
+// Note: decoding deliberately stays on the EE thread.  A decode thread fed from the
+// input FIFO can't run ahead of the EE: both FIFOs are only 8 QWCs deep (a macroblock
+// or two), and whether a kick finishes the command -- clearing BUSY and raising
+// INTC_IPU -- must be known as soon as IPUProcessInterrupt returns, since the EE can
+// take the interrupt on its next event test.  Deferring that to a later sync point
+// would change guest-visible timing, and waiting for the thread on every kick costs
+// more than the decode itself.  Speed up the decode (VLC, IDCT, CSC) instead.
 __noinline void IPUWorker()
 {
 	pxAssert(ipuRegs.ctrl.BUSY);
@@ -285,6 +285,7 @@ extern __aligned16 tIPU_cmd ipu_cmd;
 extern int coded_block_pattern;
 
 extern void ipuReset();
+extern void ipuTestKernels();
 
 extern u32 ipuRead32(u32 mem);
 extern u64 ipuRead64(u32 mem);
@@ -0,0 +1,208 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2016  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Correctness and speed check of the AVX2 IPU kernels against the C/reference ones.  Run
+// on demand (PCSX2_IPU_KERNEL_TEST, see SysCoreThread) since it takes a few seconds; the
+// results go to the console.
+
+#include "PrecompiledHeader.h"
+
+#include "Common.h"
+#include "IPU.h"
+#include "yuv2rgb.h"
+#include "mpeg2lib/Mpeg.h"
+
+static const int IdctTestBlocks = 1000000;
+static const int CscTestMacroblocks = 200000;
+static const int BenchMacroblocks = 200000;
+
+static u32 s_testSeed;
+
+static u32 TestRand()
+{
+	s_testSeed = s_testSeed * 1103515245 + 12345;
+	return s_testSeed >> 8;
+}
+
+// Coefficient blocks shaped like the ones the decoder produces: a DC term only, a few low
+// frequency terms, sparse blocks, and full random noise (corrupt streams).
+static void MakeTestBlock(s16* block)
+{
+	const int shape = TestRand() % 5;
+
+	for (int i = 0; i < 64; ++i)
+	{
+		int v;
+		switch (shape)
+		{
+			case 0: v = (s16)TestRand(); break;
+			case 1: v = (i == 0) ? (int)(TestRand() % 4096) - 2048 : 0; break;
+			case 2: v = (TestRand() % 6 == 0) ? (int)(TestRand() % 512) - 256 : 0; break;
+			case 3: v = (i < 10 || TestRand() % 8 == 0) ? (int)(TestRand() % 2048) - 1024 : 0; break;
+			default: v = ((i & 7) == 0 || TestRand() % 4 == 0) ? (int)(TestRand() % 64) - 32 : 0; break;
+		}
+		block[i] = v;
+	}
+}
+
+static double TicksToSeconds(u64 ticks)
+{
+	return (double)ticks / (double)GetTickFrequency();
+}
+
+static void ReportSpeed(const char* name, u64 ticks, int macroblocks, int bytesPerMacroblock)
+{
+	const double sec = TicksToSeconds(ticks);
+	Console.WriteLn("    %-12s %8.2f M macroblocks/s  %8.1f MB/s", name,
+		macroblocks / sec / 1e6, (double)macroblocks * bytesPerMacroblock / sec / (1024 * 1024));
+}
+
+static void TestIdct()
+{
+	uint mismatches = 0;
+
+	for (int n = 0; n < IdctTestBlocks; ++n)
+	{
+		__aligned16 s16 blk_c[64], blk_avx[64];
+		MakeTestBlock(blk_c);
+		memcpy(blk_avx, blk_c, sizeof(blk_c));
+
+		// The C copy saturates through a table that only covers the output range of legal
+		// streams, so only blocks that stay within it are used for the copy path.
+		__aligned16 s16 probe[64], range[8 * 8];
+		memcpy(probe, blk_c, sizeof(probe));
+		mpeg2_idct_add_c(0, probe, range, 8);
+
+		bool inRange = true;
+		for (int i = 0; i < 64; ++i)
+			if (range[i] < -384 || range[i] >= 640) inRange = false;
+
+		if (inRange && (TestRand() & 1))
+		{
+			u8 out_c[8 * 16], out_avx[8 * 16];
+			memzero(out_c);
+			memzero(out_avx);
+
+			mpeg2_idct_copy_c(blk_c, out_c, 16);
+			mpeg2_idct_copy_avx2(blk_avx, out_avx, 16);
+			if (memcmp(out_c, out_avx, sizeof(out_c))) ++mismatches;
+		}
+		else
+		{
+			__aligned16 s16 out_c[8 * 16], out_avx[8 * 16];
+			const int last = (TestRand() & 1) ? 129 : TestRand() % 64;
+
+			mpeg2_idct_add_c(last, blk_c, out_c, 16);
+			mpeg2_idct_add_avx2(last, blk_avx, out_avx, 16);
+			for (int row = 0; row < 8; ++row)
+			{
+				if (memcmp(out_c + row * 16, out_avx + row * 16, 8 * sizeof(s16)))
+				{
+					++mismatches;
+					break;
+				}
+			}
+		}
+
+		// Both versions clear the coefficient block for the next macroblock.
+		if (memcmp(blk_c, blk_avx, sizeof(blk_c))) ++mismatches;
+	}
+
+	Console.WriteLn("  idct copy/add: %d blocks, %u mismatches", IdctTestBlocks, mismatches);
+
+	// Six 8x8 blocks per 4:2:0 macroblock.
+	void (*const copy[2])(s16*, u8*, int) = { mpeg2_idct_copy_c, mpeg2_idct_copy_avx2 };
+	const char* const names[2] = { "idct c", "idct avx2" };
+
+	for (int k = 0; k < 2; ++k)
+	{
+		__aligned16 s16 blk[64];
+		u8 out[8 * 8];
+		memzero(blk);
+
+		const u64 start = GetCPUTicks();
+		for (int n = 0; n < BenchMacroblocks * 6; ++n)
+		{
+			for (int i = 0; i < 64; i += 7) blk[i] = n + i;
+			copy[k](blk, out, 8);
+		}
+		ReportSpeed(names[k], GetCPUTicks() - start, BenchMacroblocks, 6 * 64);
+	}
+}
+
+static void TestCscAndDither()
+{
+	uint cscMismatches = 0;
+	uint ditherMismatches = 0;
+
+	for (int n = 0; n < CscTestMacroblocks; ++n)
+	{
+		for (uint i = 0; i < sizeof(decoder.mb8); ++i)
+			((u8*)&decoder.mb8)[i] = TestRand();
+
+		yuv2rgb_reference();
+		const macroblock_rgb32 ref = decoder.rgb32;
+		yuv2rgb_avx2();
+		if (memcmp(&ref, &decoder.rgb32, sizeof(ref))) ++cscMismatches;
+
+		// Mark random pixels as half transparent to exercise the alpha bit.
+		macroblock_rgb32 rgb32 = ref;
+		for (int i = 0; i < 16 * 16; ++i)
+			if (TestRand() & 1) rgb32.c[i >> 4][i & 15].a = 0x40;
+
+		macroblock_rgb16 rgb16_c, rgb16_avx;
+		ipu_dither_c(rgb32, rgb16_c, 0);
+		ipu_dither_avx2(rgb32, rgb16_avx, 0);
+		if (memcmp(&rgb16_c, &rgb16_avx, sizeof(rgb16_c))) ++ditherMismatches;
+	}
+
+	Console.WriteLn("  yuv2rgb: %d macroblocks, %u mismatches against yuv2rgb_reference", CscTestMacroblocks, cscMismatches);
+	Console.WriteLn("  dither: %d macroblocks, %u mismatches", CscTestMacroblocks, ditherMismatches);
+
+	void (*const csc[3])() = { yuv2rgb_reference, yuv2rgb_sse2, yuv2rgb_avx2 };
+	const char* const names[3] = { "csc ref", "csc sse2", "csc avx2" };
+
+	for (int k = 0; k < 3; ++k)
+	{
+		const u64 start = GetCPUTicks();
+		for (int n = 0; n < BenchMacroblocks; ++n)
+		{
+			decoder.mb8.Y[0][0] = n;
+			csc[k]();
+		}
+		ReportSpeed(names[k], GetCPUTicks() - start, BenchMacroblocks, sizeof(macroblock_rgb32));
+	}
+}
+
+void ipuTestKernels()
+{
+	if (!x86caps.hasAVX2)
+	{
+		Console.WriteLn("IPU kernel test: the host has no AVX2, nothing to compare.");
+		return;
+	}
+
+	Console.WriteLn("IPU kernel test (AVX2 against C/reference):");
+
+	// The colour conversion kernels work on the global decoder state.
+	ScopedAlignedAlloc<decoder_t, 16> saved(1);
+	memcpy(saved.GetPtr(), &decoder, sizeof(decoder));
+
+	s_testSeed = 1;
+	TestIdct();
+	TestCscAndDither();
+
+	memcpy(&decoder, saved.GetPtr(), sizeof(decoder));
+}
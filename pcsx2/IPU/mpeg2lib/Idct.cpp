@@ -24,7 +24,8 @@
 
 // [TODO] : There are modern SSE versions of idct (idct_mmx.c) in the mpeg2 libs that we
 // should probably upgrade to.  They use their own raw-style intrinsics and not the intel
-// compiler-integrated ones.
+// compiler-integrated ones.  An AVX2 version of this code lives in Idct_avx2.cpp and must
+// be kept bit-identical to it.
 
 #include "PrecompiledHeader.h"
 
@@ -160,7 +161,7 @@ static __fi void idct_col (s16 * const block)
     block[8*7] = (a0 - b0) >> 17;
 }
 
-__ri void mpeg2_idct_copy(s16 * block, u8 * dest, const int stride)
+__ri void mpeg2_idct_copy_c(s16 * block, u8 * dest, const int stride)
 {
     int i;
 
@@ -189,7 +190,7 @@ __ri void mpeg2_idct_copy(s16 * block, u8 * dest, const int stride)
 
 
 // stride = increment for dest in 16-bit units (typically either 8 [128 bits] or 16 [256 bits]).
-__ri void mpeg2_idct_add (const int last, s16 * block, s16 * dest, const int stride)
+__ri void mpeg2_idct_add_c(const int last, s16 * block, s16 * dest, const int stride)
 {
 	// on the IPU, stride is always assured to be multiples of QWC (bottom 3 bits are 0).
 
@@ -224,6 +225,9 @@ __ri void mpeg2_idct_add (const int last, s16 * block, s16 * dest, const int str
     }
 }
 
+void (*mpeg2_idct_copy)(s16 * block, u8* dest, int stride) = mpeg2_idct_copy_c;
+void (*mpeg2_idct_add)(int last, s16 * block, s16* dest, int stride) = mpeg2_idct_add_c;
+
 mpeg2_scan_pack::mpeg2_scan_pack()
 {
 	static const u8 mpeg2_scan_norm[64] = {
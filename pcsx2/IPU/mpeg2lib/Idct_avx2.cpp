@@ -0,0 +1,197 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2016  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// AVX2 version of the mpeg2dec integer IDCT in Idct.cpp.  Only the functions below are
+// compiled for AVX2 (__avx2), and they must only be entered when x86caps.hasAVX2 is set
+// (see ipuReset).
+//
+// The whole 8x8 block stays in registers: each row/column pass works on eight 32-bit lanes,
+// one lane per row (resp. column), and the intermediate results are truncated to 16 bits
+// exactly like the s16 stores of the scalar code, so the output is bit-identical to
+// idct_row/idct_col.  The scalar row shortcut yields the same values as the full row pass
+// and is not needed here.
+
+#include "PrecompiledHeader.h"
+
+#include "Common.h"
+#include "IPU/IPU.h"
+#include "Mpeg.h"
+
+#include <immintrin.h>
+
+#define W1 2841 /* 2048*sqrt (2)*cos (1*pi/16) */
+#define W2 2676 /* 2048*sqrt (2)*cos (2*pi/16) */
+#define W3 2408 /* 2048*sqrt (2)*cos (3*pi/16) */
+#define W5 1609 /* 2048*sqrt (2)*cos (5*pi/16) */
+#define W6 1108 /* 2048*sqrt (2)*cos (6*pi/16) */
+#define W7 565  /* 2048*sqrt (2)*cos (7*pi/16) */
+
+#define BUTTERFLY(t0,t1,W0,W1,d0,d1)	\
+do {					\
+    __m256i tmp = _mm256_mullo_epi32(_mm256_set1_epi32(W0), _mm256_add_epi32(d0, d1));	\
+    t0 = _mm256_add_epi32(tmp, _mm256_mullo_epi32(_mm256_set1_epi32((W1) - (W0)), d1));	\
+    t1 = _mm256_sub_epi32(tmp, _mm256_mullo_epi32(_mm256_set1_epi32((W1) + (W0)), d0));	\
+} while (0)
+
+// Sign-extends the low 16 bits of each lane (the scalar code stores every pass to s16).
+static __fi __avx2 __m256i trunc16(__m256i v)
+{
+	return _mm256_srai_epi32(_mm256_slli_epi32(v, 16), 16);
+}
+
+static __fi __avx2 void transpose8x8(__m256i (&v)[8])
+{
+	__m256i t0 = _mm256_unpacklo_epi32(v[0], v[1]);
+	__m256i t1 = _mm256_unpackhi_epi32(v[0], v[1]);
+	__m256i t2 = _mm256_unpacklo_epi32(v[2], v[3]);
+	__m256i t3 = _mm256_unpackhi_epi32(v[2], v[3]);
+	__m256i t4 = _mm256_unpacklo_epi32(v[4], v[5]);
+	__m256i t5 = _mm256_unpackhi_epi32(v[4], v[5]);
+	__m256i t6 = _mm256_unpacklo_epi32(v[6], v[7]);
+	__m256i t7 = _mm256_unpackhi_epi32(v[6], v[7]);
+
+	__m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+	__m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+	__m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+	__m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+	__m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+	__m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+	__m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+	__m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+	v[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+	v[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+	v[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+	v[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+	v[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+	v[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+	v[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+	v[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+// One 1-D pass over eight lanes.  v[k] holds coefficient k of every lane.  The row pass
+// (col == false) matches idct_row, the column pass matches idct_col.
+template< bool col >
+static __fi __avx2 void idct_pass(__m256i (&v)[8])
+{
+	__m256i d0, d1, d2, d3;
+	__m256i a0, a1, a2, a3, b0, b1, b2, b3;
+	__m256i t0, t1, t2, t3;
+
+	d0 = _mm256_add_epi32(_mm256_slli_epi32(v[0], 11), _mm256_set1_epi32(col ? 65536 : 128));
+	d1 = v[1];
+	d2 = _mm256_slli_epi32(v[2], 11);
+	d3 = v[3];
+	t0 = _mm256_add_epi32(d0, d2);
+	t1 = _mm256_sub_epi32(d0, d2);
+	BUTTERFLY (t2, t3, W6, W2, d3, d1);
+	a0 = _mm256_add_epi32(t0, t2);
+	a1 = _mm256_add_epi32(t1, t3);
+	a2 = _mm256_sub_epi32(t1, t3);
+	a3 = _mm256_sub_epi32(t0, t2);
+
+	d0 = v[4];
+	d1 = v[5];
+	d2 = v[6];
+	d3 = v[7];
+	BUTTERFLY (t0, t1, W7, W1, d3, d0);
+	BUTTERFLY (t2, t3, W3, W5, d1, d2);
+	b0 = _mm256_add_epi32(t0, t2);
+	b3 = _mm256_add_epi32(t1, t3);
+	t0 = _mm256_sub_epi32(t0, t2);
+	t1 = _mm256_sub_epi32(t1, t3);
+
+	const __m256i k181 = _mm256_set1_epi32(181);
+	if (col)
+	{
+		t0 = _mm256_srai_epi32(t0, 8);
+		t1 = _mm256_srai_epi32(t1, 8);
+		b1 = _mm256_mullo_epi32(_mm256_add_epi32(t0, t1), k181);
+		b2 = _mm256_mullo_epi32(_mm256_sub_epi32(t0, t1), k181);
+	}
+	else
+	{
+		b1 = _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_add_epi32(t0, t1), k181), 8);
+		b2 = _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(t0, t1), k181), 8);
+	}
+
+	const int shift = col ? 17 : 8;
+	v[0] = trunc16(_mm256_srai_epi32(_mm256_add_epi32(a0, b0), shift));
+	v[1] = trunc16(_mm256_srai_epi32(_mm256_add_epi32(a1, b1), shift));
+	v[2] = trunc16(_mm256_srai_epi32(_mm256_add_epi32(a2, b2), shift));
+	v[3] = trunc16(_mm256_srai_epi32(_mm256_add_epi32(a3, b3), shift));
+	v[4] = trunc16(_mm256_srai_epi32(_mm256_sub_epi32(a3, b3), shift));
+	v[5] = trunc16(_mm256_srai_epi32(_mm256_sub_epi32(a2, b2), shift));
+	v[6] = trunc16(_mm256_srai_epi32(_mm256_sub_epi32(a1, b1), shift));
+	v[7] = trunc16(_mm256_srai_epi32(_mm256_sub_epi32(a0, b0), shift));
+}
+
+// Runs the full 2-D IDCT on block and zeroes it.  On return rows[i] holds output row i as
+// eight s16.
+static __fi __avx2 void idct_block(s16* block, __m128i (&rows)[8])
+{
+	__m256i v[8];
+
+	// Load rows (one lane per column) and turn them into columns for the row pass.
+	for (int i = 0; i < 8; ++i)
+	{
+		v[i] = _mm256_cvtepi16_epi32(_mm_load_si128((__m128i*)(block + 8 * i)));
+		_mm_store_si128((__m128i*)(block + 8 * i), _mm_setzero_si128());
+	}
+
+	transpose8x8(v);
+	idct_pass<false>(v);
+	transpose8x8(v);
+	idct_pass<true>(v);
+
+	// Every lane is already sign-extended from 16 bits, so saturating packs are exact.
+	for (int i = 0; i < 8; ++i)
+		rows[i] = _mm_packs_epi32(_mm256_castsi256_si128(v[i]), _mm256_extracti128_si256(v[i], 1));
+}
+
+// Output clamping uses packus rather than the clip_lut; the two agree for every value a
+// legal stream (and the lut's +-384 range) can produce.
+__avx2 void mpeg2_idct_copy_avx2(s16 * block, u8 * dest, const int stride)
+{
+	__m128i rows[8];
+	idct_block(block, rows);
+
+	for (int i = 0; i < 8; ++i, dest += stride)
+		_mm_storel_epi64((__m128i*)dest, _mm_packus_epi16(rows[i], rows[i]));
+
+	_mm256_zeroupper();
+}
+
+__avx2 void mpeg2_idct_add_avx2(const int last, s16 * block, s16 * dest, const int stride)
+{
+	if (last != 129 || (block[0] & 7) == 4)
+	{
+		__m128i rows[8];
+		idct_block(block, rows);
+
+		for (int i = 0; i < 8; ++i, dest += stride)
+			_mm_store_si128((__m128i*)dest, rows[i]);
+
+		_mm256_zeroupper();
+	}
+	else
+	{
+		__m128i dc = _mm_set1_epi16(((int)block[0] + 4) >> 3);
+		block[0] = block[63] = 0;
+
+		for (int i = 0; i < 8; ++i, dest += stride)
+			_mm_store_si128((__m128i*)dest, dc);
+	}
+}
@@ -34,6 +34,7 @@
 #include "Vlc.h"
 
 #include "Utilities/MemsetFast.inl"
+#include "Utilities/MathUtils.h"
 
 const int non_linear_quantizer_scale [] =
 {
@@ -346,7 +347,7 @@ static bool get_intra_block()
 	const u8 (&quant_matrix)[64] = decoder.iq;
 	int quantizer_scale = decoder.quantizer_scale;
 	s16 * dest = decoder.DCTblock;
-	u16 code; 
+	const DCTlookup* dct_lookup = (decoder.intra_vlc_format && !decoder.mpeg1) ? DCT_B15 : DCT_B14_next;
 
 	/* decode AC coefficients */
   for (int i=1 + ipu_cmd.pos[4]; ; i++)
@@ -360,61 +361,8 @@ static bool get_intra_block()
 		  return false;
 		}
 
-		code = UBITS(16);
-
-		if (code >= 16384 && (!decoder.intra_vlc_format || decoder.mpeg1))
-		{
-		  tab = &DCT.next[(code >> 12) - 4];
-		}
-		else if (code >= 1024)
-		{
-			if (decoder.intra_vlc_format && !decoder.mpeg1)
-			{
-				tab = &DCT.tab0a[(code >> 8) - 4];
-			}
-			else
-			{
-				tab = &DCT.tab0[(code >> 8) - 4];
-			}
-		}
-		else if (code >= 512)
-		{
-			if (decoder.intra_vlc_format && !decoder.mpeg1)
-			{
-				tab = &DCT.tab1a[(code >> 6) - 8];
-			}
-			else
-			{
-				tab = &DCT.tab1[(code >> 6) - 8];
-			}
-		}
-
-		// [TODO] Optimization: Following codes can all be done by a single "expedited" lookup
-		// that should use a single unrolled DCT table instead of five separate tables used
-		// here.  Multiple conditional statements are very slow, while modern CPU data caches
-		// have lots of room to spare.
-
-		else if (code >= 256)
-		{
-			tab = &DCT.tab2[(code >> 4) - 16];
-		}
-		else if (code >= 128)
-		{    
-			tab = &DCT.tab3[(code >> 3) - 16];
-		}
-		else if (code >= 64)
-		{    
-			tab = &DCT.tab4[(code >> 2) - 16];
-		}
-		else if (code >= 32)
-		{    
-			tab = &DCT.tab5[(code >> 1) - 16];
-		}
-		else if (code >= 16)
-		{    
-			tab = &DCT.tab6[code - 16];
-		}
-		else
+		tab = GetDCTtab(dct_lookup, UBITS(16));
+		if (!tab)
 		{
 		  ipu_cmd.pos[4] = 0;
 		  return true;
@@ -503,7 +451,6 @@ static bool get_non_intra_block(int * last)
 	const u8 (&quant_matrix)[64] = decoder.niq;
 	int quantizer_scale = decoder.quantizer_scale;
 	s16 * dest = decoder.DCTblock;
-	u16 code;
 
     /* decode AC coefficients */
     for (i= ipu_cmd.pos[4] ; ; i++)
@@ -517,54 +464,8 @@ static bool get_non_intra_block(int * last)
 				return false;
 			}
 
-			code = UBITS(16);
-
-			if (code >= 16384)
-			{
-				if (i==0)
-				{
-					tab = &DCT.first[(code >> 12) - 4];
-				}
-				else
-				{			
-					tab = &DCT.next[(code >> 12)- 4];
-				}
-			}
-			else if (code >= 1024)
-			{
-				tab = &DCT.tab0[(code >> 8) - 4];
-			}
-			else if (code >= 512)
-			{		
-				tab = &DCT.tab1[(code >> 6) - 8];
-			}
-
-			// [TODO] Optimization: Following codes can all be done by a single "expedited" lookup
-			// that should use a single unrolled DCT table instead of five separate tables used
-			// here.  Multiple conditional statements are very slow, while modern CPU data caches
-			// have lots of room to spare.
-
-			else if (code >= 256)
-			{		
-				tab = &DCT.tab2[(code >> 4) - 16];
-			}
-			else if (code >= 128)
-			{		
-				tab = &DCT.tab3[(code >> 3) - 16];
-			}
-			else if (code >= 64)
-			{		
-				tab = &DCT.tab4[(code >> 2) - 16];
-			}
-			else if (code >= 32)
-			{		
-				tab = &DCT.tab5[(code >> 1) - 16];
-			}
-			else if (code >= 16)
-			{		
-				tab = &DCT.tab6[code - 16];
-			}
-			else
+			tab = GetDCTtab((i == 0) ? DCT_B14_first : DCT_B14_next, UBITS(16));
+			if (!tab)
 			{
 				ipu_cmd.pos[4] = 0;
 				return true;
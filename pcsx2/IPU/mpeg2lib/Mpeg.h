@@ -189,11 +189,16 @@ struct mpeg2_scan_pack
 };
 
 extern int bitstream_init ();
-extern u32 UBITS(uint bits);
-extern s32 SBITS(uint bits);
 
-extern void mpeg2_idct_copy(s16 * block, u8* dest, int stride);
-extern void mpeg2_idct_add(int last, s16 * block, s16* dest, int stride);
+extern void mpeg2_idct_copy_c(s16 * block, u8* dest, int stride);
+extern void mpeg2_idct_add_c(int last, s16 * block, s16* dest, int stride);
+extern void mpeg2_idct_copy_avx2(s16 * block, u8* dest, int stride);
+extern void mpeg2_idct_add_avx2(int last, s16 * block, s16* dest, int stride);
+
+// Selected by ipuReset; AVX2 when the host supports it, the C versions otherwise.
+extern void (*mpeg2_idct_copy)(s16 * block, u8* dest, int stride);
+extern void (*mpeg2_idct_add)(int last, s16 * block, s16* dest, int stride);
+extern void (*ipu_dither)(const macroblock_rgb32& rgb32, macroblock_rgb16& rgb16, int dte);
 
 extern bool mpeg2sliceIDEC();
 extern bool mpeg2_slice();
@@ -204,7 +209,8 @@ extern int get_motion_delta(const int f_code);
 extern int get_dmv();
 
 extern void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn);
-extern void ipu_dither(const macroblock_rgb32& rgb32, macroblock_rgb16& rgb16, int dte);
+extern void ipu_dither_c(const macroblock_rgb32& rgb32, macroblock_rgb16& rgb16, int dte);
+extern void ipu_dither_avx2(const macroblock_rgb32& rgb32, macroblock_rgb16& rgb16, int dte);
 extern void ipu_vq(macroblock_rgb16& rgb16, u8* indx4);
 
 extern int slice (u8 * buffer);
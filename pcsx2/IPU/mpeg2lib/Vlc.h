@@ -30,11 +30,41 @@
 #ifndef __VLC_H__
 #define __VLC_H__
 
+#include "Utilities/MathUtils.h"
+
 static __fi int GETWORD()
 {
 	return g_BP.FillBuffer(16);
 }
 
+// Peeks at the next bits of the stream without consuming them.  These are called once or
+// more per VLC symbol, so they are inlined here rather than living in IPU.cpp.
+static __fi u32 UBITS(uint bits)
+{
+	uint readpos8 = g_BP.BP/8;
+
+	uint result = BigEndian(*(u32*)( (u8*)g_BP.internal_qwc + readpos8 ));
+	uint bp7 = (g_BP.BP & 7);
+	result <<= bp7;
+	result >>= (32 - bits);
+
+	return result;
+}
+
+static __fi s32 SBITS(uint bits)
+{
+	// Read an unaligned 32 bit value and then shift the bits up and then back down.
+
+	uint readpos8 = g_BP.BP/8;
+
+	int result = BigEndian(*(s32*)( (s8*)g_BP.internal_qwc + readpos8 ));
+	uint bp7 = (g_BP.BP & 7);
+	result <<= bp7;
+	result >>= (32 - bits);
+
+	return result;
+}
+
 // Removes bits from the bitstream.  This is done independently of UBITS/SBITS because a
 // lot of mpeg streams have to read ahead and rewind bits and re-read them at different
 // bit depths or sign'age.
@@ -88,6 +118,14 @@ struct MBAtab {
     u8 len;
 };
 
+// Selects the DCTtab sub-table for a 16-bit peek, indexed by the number of leading zeros
+// of the peek (see GetDCTtab).
+struct DCTlookup {
+    const DCTtab* tab;
+    u8 shift;
+    u8 bias;
+};
+
 
 #define INTRA MACROBLOCK_INTRA
 #define QUANT MACROBLOCK_QUANT
@@ -663,4 +701,46 @@ static const __aligned16 DCTtabSet DCT =
 
 };
 
+// The AC coefficient sub-tables above are split on the position of the first set bit of
+// the code, so the sub-table (and the shift that indexes it) follows directly from the
+// leading zero count.  This turns the old chain of range compares into a single lookup.
+// Codes with 12 or more leading zeros are invalid and map to NULL; the extra entry covers
+// an all-zero peek.
+
+#define DCT_LOOKUP_TAIL \
+	{ DCT.tab1,  6,  8 }, { DCT.tab2,  4, 16 }, { DCT.tab3,  3, 16 }, { DCT.tab4,  2, 16 }, \
+	{ DCT.tab5,  1, 16 }, { DCT.tab6,  0, 16 }, \
+	{ NULL, 0, 0 }, { NULL, 0, 0 }, { NULL, 0, 0 }, { NULL, 0, 0 }, { NULL, 0, 0 }
+
+/* Table B-14, first (DC) coefficient of a non-intra block */
+static const DCTlookup DCT_B14_first[17] = {
+	{ DCT.first, 12, 4 }, { DCT.first, 12, 4 },
+	{ DCT.tab0,   8, 4 }, { DCT.tab0,   8, 4 }, { DCT.tab0,   8, 4 }, { DCT.tab0,   8, 4 },
+	DCT_LOOKUP_TAIL
+};
+
+/* Table B-14, all other coefficients */
+static const DCTlookup DCT_B14_next[17] = {
+	{ DCT.next,  12, 4 }, { DCT.next,  12, 4 },
+	{ DCT.tab0,   8, 4 }, { DCT.tab0,   8, 4 }, { DCT.tab0,   8, 4 }, { DCT.tab0,   8, 4 },
+	DCT_LOOKUP_TAIL
+};
+
+/* Table B-15 (intra_vlc_format) */
+static const DCTlookup DCT_B15[17] = {
+	{ DCT.tab0a,  8, 4 }, { DCT.tab0a,  8, 4 },
+	{ DCT.tab0a,  8, 4 }, { DCT.tab0a,  8, 4 }, { DCT.tab0a,  8, 4 }, { DCT.tab0a,  8, 4 },
+	{ DCT.tab1a,  6, 8 }, { DCT.tab2,   4, 16 }, { DCT.tab3,  3, 16 }, { DCT.tab4,  2, 16 },
+	{ DCT.tab5,   1, 16 }, { DCT.tab6,  0, 16 },
+	{ NULL, 0, 0 }, { NULL, 0, 0 }, { NULL, 0, 0 }, { NULL, 0, 0 }, { NULL, 0, 0 }
+};
+
+#undef DCT_LOOKUP_TAIL
+
+static __fi const DCTtab* GetDCTtab(const DCTlookup* lookup, u16 code)
+{
+	const DCTlookup& entry = lookup[count_leading_sign_bits(code) - 16];
+	return entry.tab ? &entry.tab[(code >> entry.shift) - entry.bias] : NULL;
+}
+
 #endif//__VLC_H__
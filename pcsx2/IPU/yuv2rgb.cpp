@@ -60,8 +60,8 @@ void yuv2rgb_reference(void)
 
 // Suikoden Tactics FMV speed results: Reference - ~72fps, SSE2 - ~120fps
 // An AVX2 version is only slightly faster than an SSE2 version (+2-3fps)
-// (or I'm a poor optimiser), though it might be worth attempting again
-// once we've ported to 64 bits (the extra registers should help).
+// (or I'm a poor optimiser); one that converts two luma rows per pass lives in
+// yuv2rgb_avx2.cpp and is selected at reset when the host supports it.
 __ri void yuv2rgb_sse2()
 {
 	const __m128i c_bias = _mm_set1_epi8(s8(IPU_C_BIAS));
@@ -149,3 +149,5 @@ __ri void yuv2rgb_sse2()
 		}
 	}
 }
+
+void (*yuv2rgb)() = yuv2rgb_sse2;
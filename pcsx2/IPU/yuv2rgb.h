@@ -17,5 +17,8 @@
 
 extern void yuv2rgb_reference();
 
-#define yuv2rgb yuv2rgb_sse2
 extern void yuv2rgb_sse2();
+extern void yuv2rgb_avx2();
+
+// Selected by ipuReset; AVX2 when the host supports it, SSE2 otherwise.
+extern void (*yuv2rgb)();
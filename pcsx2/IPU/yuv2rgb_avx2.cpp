@@ -0,0 +1,140 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2016  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// AVX2 versions of the IPU colour space conversion and rgb32 -> rgb16 reduction.  Only the
+// kernels are compiled for AVX2 (__avx2), and they must only be entered when x86caps.hasAVX2
+// is set.
+
+#include "PrecompiledHeader.h"
+
+#include "Common.h"
+#include "IPU.h"
+#include "yuv2rgb.h"
+#include "mpeg2lib/Mpeg.h"
+
+#include <immintrin.h>
+
+#define IPU_Y_BIAS 16
+#define IPU_C_BIAS 128
+#define IPU_Y_COEFF 0x95	//  1.1640625
+#define IPU_GCR_COEFF -0x68	// -0.8125
+#define IPU_GCB_COEFF -0x32	// -0.390625
+#define IPU_RCR_COEFF 0xcc	//  1.59375
+#define IPU_BCB_COEFF 0x102	//  2.015625
+
+// Same arithmetic as yuv2rgb_sse2, but both luma rows sharing a chroma row are converted at
+// once (one per 128-bit lane), so the result is bit-identical to the SSE2 and reference code.
+__avx2 void yuv2rgb_avx2()
+{
+	const __m128i c_bias = _mm_set1_epi8(s8(IPU_C_BIAS));
+	const __m256i y_bias = _mm256_set1_epi8(IPU_Y_BIAS);
+	const __m256i y_mask = _mm256_set1_epi16(s16(0xFF00));
+	const __m256i round_1bit = _mm256_set1_epi16(0x0001);
+
+	const __m256i y_coefficient = _mm256_set1_epi16(s16(IPU_Y_COEFF << 2));
+	const __m128i gcr_coefficient = _mm_set1_epi16(s16(u16(IPU_GCR_COEFF) << 2));
+	const __m128i gcb_coefficient = _mm_set1_epi16(s16(u16(IPU_GCB_COEFF) << 2));
+	const __m128i rcr_coefficient = _mm_set1_epi16(s16(IPU_RCR_COEFF << 2));
+	const __m128i bcb_coefficient = _mm_set1_epi16(s16(IPU_BCB_COEFF << 2));
+
+	// Alpha set to 0x80 here. The threshold stuff is done later.
+	const __m256i alpha = _mm256_set1_epi8(s8(IPU_C_BIAS));
+
+	for (int n = 0; n < 8; ++n) {
+		__m128i cb = _mm_loadl_epi64(reinterpret_cast<__m128i*>(&decoder.mb8.Cb[n][0]));
+		__m128i cr = _mm_loadl_epi64(reinterpret_cast<__m128i*>(&decoder.mb8.Cr[n][0]));
+
+		// (Cb - 128) << 8, (Cr - 128) << 8
+		cb = _mm_xor_si128(cb, c_bias);
+		cr = _mm_xor_si128(cr, c_bias);
+		cb = _mm_unpacklo_epi8(_mm_setzero_si128(), cb);
+		cr = _mm_unpacklo_epi8(_mm_setzero_si128(), cr);
+
+		__m256i rc = _mm256_broadcastsi128_si256(_mm_mulhi_epi16(cr, rcr_coefficient));
+		__m256i gc = _mm256_broadcastsi128_si256(_mm_adds_epi16(_mm_mulhi_epi16(cr, gcr_coefficient), _mm_mulhi_epi16(cb, gcb_coefficient)));
+		__m256i bc = _mm256_broadcastsi128_si256(_mm_mulhi_epi16(cb, bcb_coefficient));
+
+		// Luma rows n*2 and n*2+1 are contiguous.
+		__m256i y = _mm256_loadu_si256(reinterpret_cast<__m256i*>(&decoder.mb8.Y[n * 2][0]));
+		y = _mm256_subs_epu8(y, y_bias);
+		__m256i y_even = _mm256_mulhi_epu16(_mm256_slli_epi16(y, 8), y_coefficient);
+		__m256i y_odd  = _mm256_mulhi_epu16(_mm256_and_si256(y, y_mask), y_coefficient);
+
+		__m256i r_even = _mm256_srai_epi16(_mm256_add_epi16(_mm256_adds_epi16(rc, y_even), round_1bit), 1);
+		__m256i r_odd  = _mm256_srai_epi16(_mm256_add_epi16(_mm256_adds_epi16(rc, y_odd),  round_1bit), 1);
+		__m256i g_even = _mm256_srai_epi16(_mm256_add_epi16(_mm256_adds_epi16(gc, y_even), round_1bit), 1);
+		__m256i g_odd  = _mm256_srai_epi16(_mm256_add_epi16(_mm256_adds_epi16(gc, y_odd),  round_1bit), 1);
+		__m256i b_even = _mm256_srai_epi16(_mm256_add_epi16(_mm256_adds_epi16(bc, y_even), round_1bit), 1);
+		__m256i b_odd  = _mm256_srai_epi16(_mm256_add_epi16(_mm256_adds_epi16(bc, y_odd),  round_1bit), 1);
+
+		// combine even and odd bytes in original order (per lane)
+		__m256i r = _mm256_packus_epi16(r_even, r_odd);
+		__m256i g = _mm256_packus_epi16(g_even, g_odd);
+		__m256i b = _mm256_packus_epi16(b_even, b_odd);
+
+		r = _mm256_unpacklo_epi8(r, _mm256_shuffle_epi32(r, _MM_SHUFFLE(3, 2, 3, 2)));
+		g = _mm256_unpacklo_epi8(g, _mm256_shuffle_epi32(g, _MM_SHUFFLE(3, 2, 3, 2)));
+		b = _mm256_unpacklo_epi8(b, _mm256_shuffle_epi32(b, _MM_SHUFFLE(3, 2, 3, 2)));
+
+		__m256i rg_l = _mm256_unpacklo_epi8(r, g);
+		__m256i ba_l = _mm256_unpacklo_epi8(b, alpha);
+		__m256i rgba_ll = _mm256_unpacklo_epi16(rg_l, ba_l);
+		__m256i rgba_lh = _mm256_unpackhi_epi16(rg_l, ba_l);
+
+		__m256i rg_h = _mm256_unpackhi_epi8(r, g);
+		__m256i ba_h = _mm256_unpackhi_epi8(b, alpha);
+		__m256i rgba_hl = _mm256_unpacklo_epi16(rg_h, ba_h);
+		__m256i rgba_hh = _mm256_unpackhi_epi16(rg_h, ba_h);
+
+		// Low lanes belong to the first row, high lanes to the second.
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&decoder.rgb32.c[n * 2][0]), _mm256_permute2x128_si256(rgba_ll, rgba_lh, 0x20));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&decoder.rgb32.c[n * 2][8]), _mm256_permute2x128_si256(rgba_hl, rgba_hh, 0x20));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&decoder.rgb32.c[n * 2 + 1][0]), _mm256_permute2x128_si256(rgba_ll, rgba_lh, 0x31));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&decoder.rgb32.c[n * 2 + 1][8]), _mm256_permute2x128_si256(rgba_hl, rgba_hh, 0x31));
+	}
+	_mm256_zeroupper();
+}
+
+// rgb32 -> rgb16 (5:5:5:1), matching the scalar loop in ipu_dither_c: each channel is
+// truncated to 5 bits and the alpha bit is set for pixels whose alpha is 0x40.
+__avx2 void ipu_dither_avx2(const macroblock_rgb32& rgb32, macroblock_rgb16& rgb16, int dte)
+{
+	const __m256i mask5 = _mm256_set1_epi32(0x1f);
+	const __m256i alpha_half = _mm256_set1_epi32(0x40 << 24);
+	const __m256i alpha_mask = _mm256_set1_epi32(0xff000000);
+	const __m256i alpha_bit = _mm256_set1_epi32(0x8000);
+
+	for (int i = 0; i < 16; ++i)
+	{
+		__m256i p[2];
+		for (int k = 0; k < 2; ++k)
+		{
+			__m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&rgb32.c[i][k * 8]));
+
+			__m256i r = _mm256_and_si256(_mm256_srli_epi32(c, 3), mask5);
+			__m256i g = _mm256_and_si256(_mm256_srli_epi32(c, 11), mask5);
+			__m256i b = _mm256_and_si256(_mm256_srli_epi32(c, 19), mask5);
+			__m256i a = _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_and_si256(c, alpha_mask), alpha_half), alpha_bit);
+
+			p[k] = _mm256_or_si256(_mm256_or_si256(r, _mm256_slli_epi32(g, 5)), _mm256_or_si256(_mm256_slli_epi32(b, 10), a));
+		}
+
+		// Every lane is below 0x10000, so the unsigned pack is exact; packus interleaves
+		// the 128-bit lanes, which the permute undoes.
+		__m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(p[0], p[1]), _MM_SHUFFLE(3, 1, 2, 0));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&rgb16.c[i][0]), packed);
+	}
+	_mm256_zeroupper();
+}
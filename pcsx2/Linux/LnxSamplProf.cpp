@@ -0,0 +1,434 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2015  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+
+#include "SamplProf.h"
+#include "R5900.h"
+
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+
+#include <dlfcn.h>
+#include <errno.h>
+#include <signal.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <time.h>
+#include <sys/syscall.h>
+
+// Older glibc headers only expose the union member
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+// --------------------------------------------------------------------------------------
+//  Linux sampling profiler
+// --------------------------------------------------------------------------------------
+// Samples are taken by a POSIX timer on the EE thread's CPU clock, which delivers SIGPROF to
+// the EE thread only (SIGEV_THREAD_ID), like the Win32 version samples hEmuThread.  The EE
+// thread is registered by ProfilerSetEEThread when it starts, so the profiler may be started
+// from any thread.  The signal handler only stores the interrupted host PC and the EE's pc
+// into a fixed ring (guarded per slot by a sequence number, seqlock style); everything else
+// (module lookup, dladdr symbolization, sorting) is done by a low-priority reporting thread,
+// so the handler stays async-signal-safe.
+//
+// Host PCs are attributed to the named sources registered through ProfilerRegisterSource
+// (recompiler reserves, dispatchers, newVif/microVU caches), then to the host function
+// symbol via dladdr.  When the profiler stops, the registered sources are appended to
+// /tmp/perf-<pid>.map so that `perf report` can resolve recompiled code; the file is shared
+// with the per-block map written by Perf::dump, so it is never truncated here.
+
+static const uint SampleRingSize = 0x4000;	// must be a power of two
+static const uint SampleRateHz   = 1000;
+static const uint ReportInterval = 5;		// seconds between console reports
+
+struct Sample
+{
+	std::atomic<u32>  seq;		// index + 1 once written, 0 while being written
+	std::atomic<uptr> host_pc;
+	std::atomic<u32>  guest_pc;
+};
+
+struct Module
+{
+	wxString name;
+	uptr base;
+	uptr end;		// zero means "everything belonging to the shared object at base"
+	u32 ticks;
+
+	Module(const wxString& _name, uptr _base, uptr _end)
+		: name(_name), base(_base), end(_end), ticks(0) {}
+
+	bool Inside(uptr val, uptr dsobase) const
+	{
+		return end ? (val >= base && val <= end) : (dsobase == base);
+	}
+};
+
+static Sample s_samples[SampleRingSize];
+static std::atomic<u32> s_sampleWritePos(0);
+
+static std::vector<Module> ProfModules;
+static Threading::Mutex ProfModulesLock;
+
+static pthread_t s_eeThread;
+static pid_t s_eeTid = 0;
+static pthread_t s_profThread;
+static sem_t s_profWake;
+static timer_t s_sampleTimer;
+static struct sigaction s_oldSigProf;
+
+static volatile bool ProfRunning = false;
+static volatile bool ProfEnabled = false;
+
+static void SigProfHandler(int sig, siginfo_t* info, void* context)
+{
+	const ucontext_t* uc = (const ucontext_t*)context;
+
+#ifdef __x86_64__
+	uptr pc = (uptr)uc->uc_mcontext.gregs[REG_RIP];
+#else
+	uptr pc = (uptr)uc->uc_mcontext.gregs[REG_EIP];
+#endif
+
+	u32 idx = s_sampleWritePos.fetch_add(1, std::memory_order_relaxed);
+	Sample& s = s_samples[idx & (SampleRingSize-1)];
+
+	s.seq.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	s.host_pc.store(pc, std::memory_order_relaxed);
+	s.guest_pc.store(cpuRegs.pc, std::memory_order_relaxed);
+	s.seq.store(idx + 1, std::memory_order_release);
+}
+
+static void SetSampleTimer(bool enabled)
+{
+	struct itimerspec timer;
+	timer.it_interval.tv_sec  = 0;
+	timer.it_interval.tv_nsec = enabled ? (1000000000 / SampleRateHz) : 0;
+	timer.it_value = timer.it_interval;
+	timer_settime(s_sampleTimer, 0, &timer, NULL);
+}
+
+static bool _registeredName( const wxString& name )
+{
+	for( std::vector<Module>::const_iterator
+		iter = ProfModules.begin(),
+		end = ProfModules.end(); iter<end; ++iter )
+	{
+		if( iter->name.compare( name ) == 0 )
+			return true;
+	}
+	return false;
+}
+
+void ProfilerRegisterSource(const wxString& Name, const void* buff, u32 sz)
+{
+	Threading::ScopedLock lock( ProfModulesLock );
+
+	if( !_registeredName( Name ) )
+		ProfModules.push_back( Module( Name, (uptr)buff, (uptr)buff + sz - 1 ) );
+}
+
+void ProfilerRegisterSource(const wxString& Name, const void* function)
+{
+	Dl_info dli;
+	if( !dladdr( function, &dli ) ) return;
+
+	Threading::ScopedLock lock( ProfModulesLock );
+
+	if( !_registeredName( Name ) )
+		ProfModules.push_back( Module( Name, (uptr)dli.dli_fbase, 0 ) );
+}
+
+void ProfilerRegisterSource(const char* Name, const void* buff, u32 sz)
+{
+	ProfilerRegisterSource( fromUTF8(Name), buff, sz );
+}
+
+void ProfilerRegisterSource(const char* Name, const void* function)
+{
+	ProfilerRegisterSource( fromUTF8(Name), function );
+}
+
+void ProfilerTerminateSource( const wxString& Name )
+{
+	Threading::ScopedLock lock( ProfModulesLock );
+
+	for( std::vector<Module>::iterator
+		iter = ProfModules.begin(),
+		end = ProfModules.end(); iter<end; ++iter )
+	{
+		if( iter->name.compare( Name ) == 0 )
+		{
+			ProfModules.erase( iter );
+			break;
+		}
+	}
+}
+
+void ProfilerTerminateSource( const char* Name )
+{
+	ProfilerTerminateSource( fromUTF8(Name) );
+}
+
+// Appends the registered code ranges in the format perf expects for JIT symbol maps.
+static void WritePerfMap()
+{
+	char file[256];
+	snprintf(file, sizeof(file), "/tmp/perf-%d.map", getpid());
+	FILE* fp = fopen(file, "a");
+	if (!fp) return;
+
+	Threading::ScopedLock lock( ProfModulesLock );
+	for (size_t i = 0; i < ProfModules.size(); ++i)
+	{
+		const Module& mod = ProfModules[i];
+		if (!mod.end) continue;
+		fprintf(fp, "%lx %lx %s\n", (unsigned long)mod.base, (unsigned long)(mod.end - mod.base + 1),
+			(const char*)mod.name.ToUTF8());
+	}
+
+	fclose(fp);
+}
+
+static wxString FormatTicks(const wxString& name, u32 ticks, u32 total_ticks)
+{
+	return wxsFormat( L"| %s: %2.2f%% |", WX_STR(name), (float)(((double)ticks*100.0) / (double)total_ticks) );
+}
+
+template< typename KeyType >
+static std::vector< std::pair<u32, KeyType> > SortByTicks(const std::map<KeyType, u32>& hist, size_t count)
+{
+	std::vector< std::pair<u32, KeyType> > lst;
+	for (typename std::map<KeyType, u32>::const_iterator i = hist.begin(); i != hist.end(); ++i)
+		lst.push_back(std::make_pair(i->second, i->first));
+
+	std::sort(lst.rbegin(), lst.rend());
+	if (lst.size() > count) lst.resize(count);
+	return lst;
+}
+
+static void Report(const std::map<wxString, u32>& hosthist, const std::map<u32, u32>& guesthist, u32 tick_count)
+{
+	wxString rT, rv, rg;
+	u32 subtotal = 0;
+
+	{
+		Threading::ScopedLock lock( ProfModulesLock );
+		for (size_t i = 0; i < ProfModules.size(); ++i)
+		{
+			if (!ProfModules[i].ticks) continue;
+			rT += FormatTicks(ProfModules[i].name, ProfModules[i].ticks, tick_count);
+			subtotal += ProfModules[i].ticks;
+			ProfModules[i].ticks = 0;
+		}
+	}
+	rT += wxsFormat( L"| Recs Total: %2.2f%% |", (float)(((double)subtotal*100.0) / (double)tick_count));
+
+	std::vector< std::pair<u32, wxString> > hosts( SortByTicks(hosthist, 16) );
+	for (size_t i = 0; i < hosts.size(); ++i)
+		rv += FormatTicks(hosts[i].second, hosts[i].first, tick_count);
+
+	std::vector< std::pair<u32, u32> > guests( SortByTicks(guesthist, 16) );
+	for (size_t i = 0; i < guests.size(); ++i)
+		rg += FormatTicks(wxsFormat(L"EE %08x", guests[i].second), guests[i].first, tick_count);
+
+	Console.WriteLn( L"Sampling Profiler Results:\n%s\n%s\n%s\n", WX_STR(rT), WX_STR(rv), WX_STR(rg) );
+	Console.SetTitle(rT);
+}
+
+static void* ProfilerThread(void* nada)
+{
+	std::map<wxString, u32> hosthist;
+	std::map<u32, u32> guesthist;
+	u32 tick_count = 0;
+	u32 readpos = s_sampleWritePos.load(std::memory_order_acquire);
+	u32 elapsed = 0;
+
+	while (ProfRunning)
+	{
+		// Sleeps 100ms, or until ProfilerTerm wakes us
+		struct timespec deadline;
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		deadline.tv_nsec += 100 * 1000 * 1000;
+		if (deadline.tv_nsec >= 1000000000)
+		{
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000;
+		}
+
+		while (sem_timedwait(&s_profWake, &deadline) != 0 && errno == EINTR)
+			;
+
+		u32 writepos = s_sampleWritePos.load(std::memory_order_acquire);
+
+		// The handler overran us; skip what has been overwritten.
+		if (writepos - readpos > SampleRingSize)
+			readpos = writepos - SampleRingSize;
+
+		for (; readpos != writepos; ++readpos)
+		{
+			const Sample& s = s_samples[readpos & (SampleRingSize-1)];
+
+			// Slot still being written (or already recycled): drop it.
+			const u32 seq = s.seq.load(std::memory_order_acquire);
+			if (seq != readpos + 1) continue;
+
+			const uptr pc = s.host_pc.load(std::memory_order_relaxed);
+			const u32 guest_pc = s.guest_pc.load(std::memory_order_relaxed);
+
+			// Rewritten while we were reading it: the payload may be torn, drop it.
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (s.seq.load(std::memory_order_relaxed) != seq) continue;
+
+			Dl_info dli;
+			const bool resolved = dladdr((void*)pc, &dli) != 0;
+			bool known = false;
+
+			tick_count++;
+			guesthist[guest_pc]++;
+
+			{
+				Threading::ScopedLock lock( ProfModulesLock );
+				for (size_t i = 0; i < ProfModules.size(); ++i)
+				{
+					if (ProfModules[i].Inside(pc, resolved ? (uptr)dli.dli_fbase : 0))
+					{
+						ProfModules[i].ticks++;
+						known = true;
+						break;
+					}
+				}
+			}
+
+			if (known) continue;
+
+			if (!resolved)
+				hosthist[L"[Unknown]"]++;
+			else if (dli.dli_sname)
+				hosthist[fromUTF8(dli.dli_sname)]++;
+			else
+				hosthist[fromUTF8(dli.dli_fname)]++;
+		}
+
+		if (++elapsed >= ReportInterval * 10 && tick_count)
+		{
+			Report(hosthist, guesthist, tick_count);
+
+			hosthist.clear();
+			guesthist.clear();
+			tick_count = 0;
+			elapsed = 0;
+		}
+	}
+
+	return NULL;
+}
+
+// Called on the EE thread when it starts; only that thread is sampled.
+void ProfilerSetEEThread()
+{
+	s_eeThread = pthread_self();
+	s_eeTid = (pid_t)syscall(SYS_gettid);
+}
+
+void ProfilerInit()
+{
+	if (ProfRunning)
+		return;
+
+	if (!s_eeTid)
+	{
+		Console.Warning( "Profiler: the EE thread isn't running, nothing to sample." );
+		return;
+	}
+
+	Console.WriteLn( "Profiler Thread Initializing..." );
+
+	clockid_t clock;
+	if (pthread_getcpuclockid(s_eeThread, &clock) != 0)
+		clock = CLOCK_MONOTONIC;
+
+	struct sigevent sev;
+	memzero(sev);
+	sev.sigev_notify = SIGEV_THREAD_ID;
+	sev.sigev_signo = SIGPROF;
+	sev.sigev_notify_thread_id = s_eeTid;
+
+	if (timer_create(clock, &sev, &s_sampleTimer) != 0)
+	{
+		Console.Error( "Profiler: timer_create failed (errno %d).", errno );
+		return;
+	}
+
+	ProfRunning = true;
+	sem_init(&s_profWake, 0, 0);
+
+	struct sigaction sa;
+	memzero(sa);
+	sa.sa_sigaction = SigProfHandler;
+	sa.sa_flags = SA_SIGINFO | SA_RESTART;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGPROF, &sa, &s_oldSigProf);
+
+	pthread_create(&s_profThread, NULL, ProfilerThread, NULL);
+
+	ProfEnabled = true;
+	SetSampleTimer(true);
+	Console.WriteLn( "Profiler Thread Started!" );
+}
+
+void ProfilerTerm()
+{
+	if (!ProfRunning)
+		return;
+
+	Console.WriteLn( "Profiler Terminating..." );
+
+	SetSampleTimer(false);
+	timer_delete(s_sampleTimer);
+	ProfEnabled = false;
+	ProfRunning = false;
+
+	sem_post(&s_profWake);
+	pthread_join(s_profThread, NULL);
+	sem_destroy(&s_profWake);
+	sigaction(SIGPROF, &s_oldSigProf, NULL);
+
+	WritePerfMap();
+	Console.WriteLn( "Profiler Termination Done!" );
+}
+
+void ProfilerSetEnabled(bool Enabled)
+{
+	if (!ProfRunning)
+	{
+		if( !Enabled ) return;
+		ProfilerInit();
+		if (!ProfRunning) return;
+	}
+
+	if (ProfEnabled != Enabled)
+	{
+		ProfEnabled = Enabled;
+		SetSampleTimer(Enabled);
+	}
+}
@@ -75,14 +75,22 @@ void VU_Thread::Reset()
 {
 	ScopedLock lock(mtxBusy);
 
+	if (stats.commands) {
+		DevCon.WriteLn("MTVU: %llu commands in %llu batches (largest %u), %llu merged mem writes, %llu ring stalls",
+			stats.commands, stats.batches, stats.maxBatch, stats.mergedWrites, stats.stalls);
+	}
+
 	read_pos     = 0;
 	write_pos    = 0;
 	write_offset = 0;
+	last_write   = -1;
+	batch_count  = 0;
 	vuCycleIdx   = 0;
 	isBusy = false;
 	memzero(vif);
 	memzero(vifRegs);
 	memzero(vuCycles);
+	memzero(stats);
 }
 
 void VU_Thread::ExecuteTaskInThread()
@@ -151,14 +159,18 @@ void VU_Thread::ExecuteRingBuffer()
 }
 
 
-// Should only be called by ReserveSpace()
+// Should only be called by ReserveSpace()/MergeMemWrite()
+// Size is counted from write_pos, so it must include the staged write_offset
 __ri void VU_Thread::WaitOnSize(s32 size)
 {
+	bool stalled = false;
 	for(;;) {
 		s32 readPos  = GetReadPos();
 		if (readPos <= write_pos) break; // MTVU is reading in back of write_pos
 		if (readPos >  write_pos + size) break; // Enough free front space
 		if (1) { // Let MTVU run to free up buffer space
+			if (!stalled) stats.stalls++;
+			stalled = true;
 			KickStart();
 			if (IsDevBuild) DevCon.WriteLn("WaitOnSize()");
 			ScopedLock lock(mtxBusy);
@@ -167,21 +179,26 @@ __ri void VU_Thread::WaitOnSize(s32 size)
 }
 
 // Makes sure theres enough room in the ring buffer
-// to write a continuous 'size * sizeof(u32)' bytes
+// to write a continuous 'size * sizeof(u32)' bytes after the staged commands
 void VU_Thread::ReserveSpace(s32 size)
 {
 	pxAssert(write_pos < buffer_size);
 	pxAssert(size      < buffer_size);
 	pxAssert(size > 0);
-	pxAssert(write_offset == 0);
-	if (write_pos + size > buffer_size) {
-		pxAssert(write_pos > 0);
-		WaitOnSize(1); // Size of MTVU_NULL_PACKET
-		Write(MTVU_NULL_PACKET);
-		write_offset = 0;
-		AtomicExchange(volatize(write_pos), 0);
+	if (write_offset + size > batch_size) {
+		Flush(); // Don't let MTVU starve behind a huge batch
+	}
+	if (write_pos + write_offset + size > buffer_size) {
+		incWritePos(); // Staged commands must be visible before wrapping
+		if (write_pos + size > buffer_size) {
+			pxAssert(write_pos > 0);
+			WaitOnSize(1); // Size of MTVU_NULL_PACKET
+			Write(MTVU_NULL_PACKET);
+			write_offset = 0;
+			AtomicExchange(volatize(write_pos), 0);
+		}
 	}
-	WaitOnSize(size);
+	WaitOnSize(write_offset + size);
 }
 
 // Use this when reading read_pos from ee thread
@@ -205,14 +222,46 @@ __fi void VU_Thread::incReadPos(s32 offset)
 	read_pos = (read_pos + offset) & buffer_mask;
 }
 __fi void VU_Thread::incWritePos()
-{ // Adds write_offset
+{ // Adds write_offset, publishing all staged commands with a single store
+	if (!write_offset) return;
 	s32 temp = (write_pos + write_offset) & buffer_mask;
 	write_offset = 0;
+	last_write   = -1;
+	stats.batches++;
+	stats.maxBatch = std::max(stats.maxBatch, batch_count);
+	batch_count  = 0;
 	AtomicExchange(volatize(write_pos), temp);
 	if (MTVU_ALWAYS_KICK) KickStart();
 	if (MTVU_SYNC_MODE)   WaitVU();
 }
 
+// Ends a command; it stays invisible to MTVU until the batch is published
+__fi void VU_Thread::CommitCommand()
+{
+	stats.commands++;
+	batch_count++;
+	if (MTVU_ALWAYS_KICK || MTVU_SYNC_MODE) incWritePos();
+}
+
+// Appends a micro/data mem write to the previous staged command of the same
+// type, if it is the last staged command and the write continues its range
+bool VU_Thread::MergeMemWrite(u32 tag, u32 addr, void* data, u32 size)
+{
+	if (last_write < 0 || (size & 3)) return false;
+	u32* cmd = &buffer[(write_pos + last_write) & buffer_mask];
+	if (cmd[0] != tag || (cmd[2] & 3) || cmd[1] + cmd[2] != addr) return false;
+	if (last_write + 3 + (s32)size_u32(cmd[2]) != write_offset) return false;
+
+	s32 newSize = write_offset + size_u32(size);
+	if (newSize > batch_size || write_pos + newSize > buffer_size) return false;
+
+	WaitOnSize(newSize);
+	Write(data, size);
+	cmd[2] += size;
+	stats.mergedWrites++;
+	return true;
+}
+
 __fi u32 VU_Thread::Read()
 {
 	u32 ret = buffer[read_pos];
@@ -277,12 +326,19 @@ void VU_Thread::KickStart(bool forceKick)
 
 bool VU_Thread::IsDone()
 {
-	return !isBusy && GetReadPos() == GetWritePos();
+	return !isBusy && !write_offset && GetReadPos() == GetWritePos();
+}
+
+void VU_Thread::Flush()
+{
+	incWritePos();
+	KickStart();
 }
 
 void VU_Thread::WaitVU()
 {
 	MTVU_LOG("MTVU - WaitVU!");
+	incWritePos();
 	for(;;) {
 		if (IsDone()) break;
 		//DevCon.WriteLn("WaitVU()");
@@ -300,6 +356,7 @@ void VU_Thread::ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop)
 	Write(vu_addr);
 	Write(vif_top);
 	Write(vif_itop);
+	CommitCommand();
 	incWritePos();
 	gifUnit.TransferGSPacketData(GIF_TRANS_MTVU, NULL, 0);
 	KickStart();
@@ -317,30 +374,33 @@ void VU_Thread::VifUnpack(vifStruct& _vif, VIFregisters& _vifRegs, u8* data, u32
 	WriteRegs(&_vifRegs);
 	Write(size);
 	Write(data, size);
-	incWritePos();
-	KickStart();
+	CommitCommand();
 }
 
 void VU_Thread::WriteMicroMem(u32 vu_micro_addr, void* data, u32 size)
 {
 	MTVU_LOG("MTVU - WriteMicroMem!");
+	if (MergeMemWrite(MTVU_VU_WRITE_MICRO, vu_micro_addr, data, size)) return;
 	ReserveSpace(3 + size_u32(size));
+	last_write = write_offset;
 	Write(MTVU_VU_WRITE_MICRO);
 	Write(vu_micro_addr);
 	Write(size);
 	Write(data, size);
-	incWritePos();
+	CommitCommand();
 }
 
 void VU_Thread::WriteDataMem(u32 vu_data_addr, void* data, u32 size)
 {
 	MTVU_LOG("MTVU - WriteDataMem!");
+	if (MergeMemWrite(MTVU_VU_WRITE_DATA, vu_data_addr, data, size)) return;
 	ReserveSpace(3 + size_u32(size));
+	last_write = write_offset;
 	Write(MTVU_VU_WRITE_DATA);
 	Write(vu_data_addr);
 	Write(size);
 	Write(data, size);
-	incWritePos();
+	CommitCommand();
 }
 
 void VU_Thread::WriteCol(vifStruct& _vif)
@@ -349,7 +409,7 @@ void VU_Thread::WriteCol(vifStruct& _vif)
 	ReserveSpace(1 + size_u32(sizeof(_vif.MaskCol)));
 	Write(MTVU_VIF_WRITE_COL);
 	Write(&_vif.MaskCol, sizeof(_vif.MaskCol));
-	incWritePos();
+	CommitCommand();
 }
 
 void VU_Thread::WriteRow(vifStruct& _vif)
@@ -358,5 +418,5 @@ void VU_Thread::WriteRow(vifStruct& _vif)
 	ReserveSpace(1 + size_u32(sizeof(_vif.MaskRow)));
 	Write(MTVU_VIF_WRITE_ROW);
 	Write(&_vif.MaskRow, sizeof(_vif.MaskRow));
-	incWritePos();
+	CommitCommand();
 }
@@ -22,18 +22,33 @@
 #define MTVU_LOG(...) do{} while(0)
 //#define MTVU_LOG DevCon.WriteLn
 
+// Counters for the EE<->MTVU ring handshake (EE thread only, printed and cleared by Reset)
+struct VU_ThreadStats
+{
+	u64 commands;      // Commands written to the ring
+	u64 batches;       // Times write_pos was published
+	u64 mergedWrites;  // Micro/data mem writes appended to the previous command
+	u64 stalls;        // Times the EE had to wait for ring space
+	u32 maxBatch;      // Most commands published at once
+};
+
 // Notes:
 // - This class should only be accessed from the EE thread...
 // - buffer_size must be power of 2
 // - ring-buffer has no complete pending packets when read_pos==write_pos
+// - Commands are staged after write_pos (write_offset) and published in batches,
+//   see CommitCommand() and Flush().
 class VU_Thread : public pxThread {
 	static const s32 buffer_size = (_1mb * 16) / sizeof(s32);
 	static const u32 buffer_mask = buffer_size - 1;
+	static const s32 batch_size  = (_1kb * 64) / sizeof(s32); // Max staged u32's before publishing
 	__aligned(4) u32 buffer[buffer_size];
 	__aligned(4) std::atomic<int> read_pos; // Only modified by VU thread
 	__aligned(4) std::atomic<bool> isBusy;   // Is thread processing data?
 	__aligned(4) s32  write_pos;    // Only modified by EE thread
 	__aligned(4) s32  write_offset; // Only modified by EE thread
+	__aligned(4) s32  last_write;   // Offset of the last staged mem write command, or -1
+	__aligned(4) u32  batch_count;  // Commands staged since the last publish
 	__aligned(4) Mutex     mtxBusy;
 	__aligned(4) Semaphore semaEvent;
 	__aligned(4) BaseVUmicroCPU*& vuCPU;
@@ -45,6 +60,7 @@ public:
 	__aligned(4) Semaphore semaXGkick;
 	__aligned(4) u32 vuCycles[4]; // Used for VU cycle stealing hack
 	__aligned(4) u32 vuCycleIdx;  // Used for VU cycle stealing hack
+	VU_ThreadStats stats;
 
 	VU_Thread(BaseVUmicroCPU*& _vuCPU, VURegs& _vuRegs);
 	virtual ~VU_Thread() throw();
@@ -60,6 +76,9 @@ public:
 	// Waits till MTVU is done processing
 	void WaitVU();
 
+	// Publishes staged commands and wakes MTVU (end of a DMA transfer, etc)
+	void Flush();
+
 	void ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop);
 
 	void VifUnpack(vifStruct& _vif, VIFregisters& _vifRegs, u8* data, u32 size);
@@ -89,6 +108,8 @@ private:
 
 	void incReadPos(s32 offset);
 	void incWritePos();
+	void CommitCommand();
+	bool MergeMemWrite(u32 tag, u32 addr, void* data, u32 size);
 
 	u32 Read();
 	void Read(void* dest, u32 size);
@@ -88,6 +88,7 @@ Pcsx2Config::RecompilerOptions::RecompilerOptions()
 
 	EnableEE	= true;
 	EnableEECache = false;
+	EnableEEBlockHints = false;
 	EnableIOP	= true;
 	EnableVU0	= true;
 	EnableVU1	= true;
@@ -146,6 +147,7 @@ void Pcsx2Config::RecompilerOptions::LoadSave( IniInterface& ini )
 	IniBitBool( EnableEE );
 	IniBitBool( EnableIOP );
 	IniBitBool( EnableEECache );
+	IniBitBool( EnableEEBlockHints );
 	IniBitBool( EnableVU0 );
 	IniBitBool( EnableVU1 );
 
@@ -54,6 +54,13 @@ static const uint eeWaitCycles = 3072;
 
 bool eeEventTestIsActive = false;
 
+// Earliest cycle at which any of the pending 'pcsx2 interrupts' (cpuRegs.interrupt) is due.
+// Maintained by CPU_INT and the interrupt scan itself, so that event tests arriving before
+// this point (counters, IOP syncs, etc) can skip the per-channel TESTINT scan entirely.
+// It is allowed to be early (a cleared or rescheduled interrupt merely triggers a redundant
+// scan), but must never be later than a pending interrupt's deadline.
+static u32 s_nextIntCycle = 0;
+
 extern SysMainMemory& GetVmMemory();
 
 void cpuReset()
@@ -76,6 +83,7 @@ void cpuReset()
 	fpuRegs.fprc[31]		= 0x01000001; // fpu Status/Control
 
 	g_nextEventCycle = cpuRegs.cycle + 4;
+	cpuRescheduleInts();
 	EEsCycle = 0;
 	EEoCycle = cpuRegs.cycle;
 
@@ -248,6 +256,20 @@ __fi void cpuClearInt( uint i )
 	cpuRegs.interrupt &= ~(1 << i);
 }
 
+// Pulls the interrupt scan deadline in, if the given event is due before it.
+static __fi void cpuSetNextInt( u32 startCycle, s32 delta )
+{
+	if( (int)(s_nextIntCycle - startCycle) > delta )
+		s_nextIntCycle = startCycle + delta;
+}
+
+// Forces the next event test to rescan all pending interrupts.  Must be called whenever
+// cpuRegs is replaced wholesale (resets, savestate loads).
+void cpuRescheduleInts()
+{
+	s_nextIntCycle = cpuRegs.cycle;
+}
+
 static __fi void TESTINT( u8 n, void (*callback)() )
 {
 	if( !(cpuRegs.interrupt & (1 << n)) ) return;
@@ -258,7 +280,10 @@ static __fi void TESTINT( u8 n, void (*callback)() )
 		callback();
 	}
 	else
+	{
+		cpuSetNextInt( cpuRegs.sCycle[n], cpuRegs.eCycle[n] );
 		cpuSetNextEvent( cpuRegs.sCycle[n], cpuRegs.eCycle[n] );
+	}
 }
 
 // [TODO] move this function to LegacyDmac.cpp, and remove most of the DMAC-related headers from
@@ -268,8 +293,25 @@ static __fi void _cpuTestInterrupts()
 	if (!dmacRegs.ctrl.DMAE || (psHu8(DMAC_ENABLER+2) & 1))
 	{
 		//Console.Write("DMAC Disabled or suspended");
+		// Nothing was scanned, so the deadline may be long gone by the time the DMAC is back
+		// (and the s32 distance to it can wrap).  Rescan as soon as it is.
+		s_nextIntCycle = cpuRegs.cycle;
+		return;
+	}
+
+	if( !cpuRegs.interrupt ) return;
+
+	// Nothing can be due yet: just make sure we get back here in time.
+	s32 untilNextInt = s_nextIntCycle - cpuRegs.cycle;
+	if( untilNextInt > 0 )
+	{
+		cpuSetNextEventDelta( untilNextInt );
 		return;
 	}
+
+	// The scan below (and any CPU_INT issued by the callbacks) recomputes the deadline.
+	s_nextIntCycle = cpuRegs.cycle + eeWaitCycles;
+
 	/* These are 'pcsx2 interrupts', they handle asynchronous stuff
 	   that depends on the cycle timings */
 
@@ -495,6 +537,7 @@ __fi void CPU_INT( EE_EventType n, s32 ecycle)
 	cpuRegs.interrupt|= 1 << n;
 	cpuRegs.sCycle[n] = cpuRegs.cycle;
 	cpuRegs.eCycle[n] = ecycle;
+	cpuSetNextInt( cpuRegs.cycle, ecycle );
 
 	// Interrupt is happening soon: make sure both EE and IOP are aware.
 
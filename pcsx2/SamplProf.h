@@ -18,10 +18,10 @@
 
 #include "Common.h"
 
-// The profiler does not have a Linux version yet.
-// So for now we turn it into duds for non-Win32 platforms.
+// The profiler has Win32 (windows/SamplProf.cpp) and Linux (Linux/LnxSamplProf.cpp)
+// versions.  For other platforms we turn it into duds.
 
-#ifdef _WIN32
+#if defined(_WIN32) || defined(__linux__)
 
 void ProfilerInit();
 void ProfilerTerm();
@@ -36,7 +36,7 @@ void ProfilerTerminateSource( const wxString& Name );
 
 #else
 
-// Disables the profiler in Debug & Linux builds.
+// Disables the profiler on platforms without a sampling backend.
 // Profiling info in debug builds isn't much use anyway and the console
 // popups are annoying when you're trying to trace debug logs and stuff.
 
@@ -48,4 +48,12 @@ void ProfilerTerminateSource( const wxString& Name );
 
 #endif
 
+// Linux samples the EE thread through a per-thread timer and needs to know it up front;
+// the Win32 version grabs the calling thread in ProfilerInit.
+#ifdef __linux__
+void ProfilerSetEEThread();
+#else
+#define ProfilerSetEEThread() (void)0
+#endif
+
 #endif
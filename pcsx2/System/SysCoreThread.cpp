@@ -24,6 +24,8 @@
 #include "Patch.h"
 #include "SysThreads.h"
 #include "MTVU.h"
+#include "SamplProf.h"
+#include "IPU/IPU.h"
 
 #include "../DebugTools/MIPSAnalyst.h"
 #include "../DebugTools/SymbolMap.h"
@@ -265,6 +267,16 @@ void SysCoreThread::ExecuteTaskInThread()
 
 	m_mxcsr_saved.bitmask = _mm_getcsr();
 
+#ifdef __linux__
+	// The sampling profiler only samples this thread, so that it can attribute samples to
+	// guest code.  It is opt-in, but may also be enabled later from another thread.
+	ProfilerSetEEThread();
+	if (getenv("PCSX2_SAMPLING_PROFILER")) ProfilerInit();
+#endif
+
+	// Developer check of the AVX2 IPU kernels; see IPU_KernelTest.cpp.
+	if (getenv("PCSX2_IPU_KERNEL_TEST")) ipuTestKernels();
+
 	PCSX2_PAGEFAULT_PROTECT {
 		while(true) {
 			StateCheckInThread();
@@ -299,6 +311,9 @@ void SysCoreThread::OnCleanupInThread()
 
 	_mm_setcsr( m_mxcsr_saved.bitmask );
 	Threading::DisableHiresScheduler();
+#ifdef __linux__
+	ProfilerTerm();
+#endif
 	_parent::OnCleanupInThread();
 
 	m_ExecMode				= ExecMode_NoThreadYet;
@@ -20,6 +20,7 @@
 #include "Gif_Unit.h"
 #include "VUmicro.h"
 #include "newVif.h"
+#include "MTVU.h"
 
 u32 g_vif1Cycles = 0;
 
@@ -404,6 +405,7 @@ __fi void vif1Interrupt()
 	vif1.irqoffset.enabled = false;
 	if(vif1.queued_program == true) vifExecQueue(1);
 	g_vif1Cycles = 0;
+	if (THREAD_VU1) vu1Thread.Flush(); // Publish the unpacks of the whole chain
 	DMA_LOG("VIF1 DMA End");
 	hwDmacIrq(DMAC_VIF1);
 
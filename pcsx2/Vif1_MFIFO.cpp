@@ -18,6 +18,7 @@
 #include "Vif.h"
 #include "Gif_Unit.h"
 #include "Vif_Dma.h"
+#include "MTVU.h"
 
 u16 vifqwc = 0;
 
@@ -374,6 +375,7 @@ void vifMFIFOInterrupt()
 			case 1: //Transfer data
 				if(vif1.inprogress & 0x1) //Just in case the tag breaks early (or something wierd happens)!
 					mfifo_VIF1chain();
+				if (THREAD_VU1) vu1Thread.Flush(); // The EE may refill the MFIFO long after this slice
 				//Sanity check! making sure we always have non-zero values
 				if(!(vif1Regs.stat.VGW && gifUnit.gifPath[GIF_PATH_3].state != GIF_PATH_IDLE)) //If we're waiting on GIF, stop looping, (can be over 1000 loops!)
 					CPU_INT(DMAC_MFIFO_VIF, (g_vif1Cycles == 0 ? 4 : g_vif1Cycles) );	
@@ -390,6 +392,7 @@ void vifMFIFOInterrupt()
 	g_vif1Cycles = 0;
 	vif1Regs.stat.FQC = std::min((u16)0x10, vif1ch.qwc);
 	vif1ch.chcr.STR = false;
+	if (THREAD_VU1) vu1Thread.Flush(); // Publish the unpacks of the whole chain
 	hwDmacIrq(DMAC_VIF1);
 	DMA_LOG("VIF1 MFIFO DMA End");
 
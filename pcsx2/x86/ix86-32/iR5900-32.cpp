@@ -34,6 +34,9 @@
 
 #include "../DebugTools/Breakpoints.h"
 #include "Patch.h"
+#include "AppConfig.h"
+
+#include <map>
 
 #if !PCSX2_SEH
 #	include <csetjmp>
@@ -96,6 +99,14 @@ u32 s_nEndBlock = 0; // what pc the current block ends
 u32 s_branchTo;
 static bool s_nBlockFF;
 
+// Forward unconditional jumps (J, B) that the block scan chose to compile straight through
+// instead of ending the block.  See recCanStitchJump().
+static const uint MaxStitchedJumps = 8;
+static u32 s_stitchFrom[MaxStitchedJumps];	// pc of the jump instruction
+static u32 s_stitchTo[MaxStitchedJumps];	// its target
+static uint s_nStitchCount = 0;
+static uint s_nStitchIdx = 0;
+
 // save states for branches
 GPR_reg64 s_saveConstRegs[32];
 static u32 s_saveHasConstReg = 0, s_saveFlushedConstReg = 0;
@@ -570,6 +581,165 @@ static std::atomic<bool> eeRecIsReset(false);
 static std::atomic<bool> eeRecNeedsReset(false);
 static bool eeCpuExecuting = false;
 
+// --------------------------------------------------------------------------------------
+//  EE block hints (warm startup)
+// --------------------------------------------------------------------------------------
+// When enabled, the start address of every main-RAM block compiled while a game's ElfCRC is
+// active is remembered per ElfCRC, together with a hash of its code.  Blocks are recorded in
+// memory as they are compiled (BIOS/boot blocks compiled before the CRC is known never are);
+// the set is written to the settings cache folder when the ELF changes and at shutdown, so
+// gameplay never waits on the disk.  On the next boot of the same game, the JIT precompiles
+// the recorded blocks whose code still hashes to the recorded value.  That work is done on
+// the EE thread, but at most BlockHintsPerCompile blocks per JIT compile, so it is spread
+// over the first compiles instead of stalling the boot.
+
+struct BlockHint
+{
+	u32 startpc;	// physical address; compiled through the identity-mapped kuseg pages
+	u32 size;		// in instructions
+	u32 hash;
+};
+
+static const u32 BlockHintsMagic	= 0x48424545;	// 'EEBH'
+static const u32 BlockHintsVersion	= 1;
+static const uint BlockHintsMax		= 0x10000;
+static const uint BlockHintsPerCompile	= 64;
+
+static std::map<u32, BlockHint> s_blockHints;
+static u32 s_blockHintsCrc = 0;			// ElfCRC the hints above belong to
+static u32 s_blockHintsWarmedCrc = 0;	// ElfCRC the precompile pass has completed for
+static u32 s_blockHintsNextPc = 0;		// Where the precompile pass resumes
+static bool s_blockHintsWarming = false;	// Set while the pass compiles (it recurses into recRecompile)
+
+// Hashes the code of a block as the EE fetches it (through PSM).  Returns false if any part
+// of the block isn't in main RAM.
+static bool BlockHintHash(u32 startpc, u32 size, u32& hash)
+{
+	const u32* code = NULL;
+	hash = 2166136261u;		// FNV-1a
+
+	for (u32 i = 0; i < size; ++i)
+	{
+		const u32 pc = startpc + i * 4;
+
+		if (!code || !(pc & 0xfff))
+		{
+			code = (const u32*)PSM(pc);
+			if (!code || (uptr)((const u8*)code - eeMem->Main) >= Ps2MemSize::MainRam)
+				return false;
+		}
+
+		hash = (hash ^ *code++) * 16777619u;
+	}
+
+	return true;
+}
+
+static wxString GetBlockHintsFilename(u32 crc)
+{
+	wxDirName cacheDir( GetSettingsFolder() + wxDirName(L"cache") );
+	cacheDir.Mkdir();
+
+	return Path::Combine( cacheDir, wxFileName(wxsFormat(L"eeblocks_%08X.bin", crc)) );
+}
+
+static void recLoadBlockHints(u32 crc)
+{
+	s_blockHints.clear();
+	s_blockHintsCrc = crc;
+
+	wxFFile file( GetBlockHintsFilename(crc), L"rb" );
+	if (!file.IsOpened()) return;
+
+	u32 header[4];
+	if (file.Read(header, sizeof(header)) != sizeof(header)) return;
+	if (header[0] != BlockHintsMagic || header[1] != BlockHintsVersion || header[2] != crc) return;
+
+	std::vector<BlockHint> hints(std::min<uint>(header[3], BlockHintsMax));
+	if (hints.empty()) return;
+
+	size_t bytes = hints.size() * sizeof(BlockHint);
+	if (file.Read(&hints[0], bytes) != bytes) return;
+
+	for (size_t i = 0; i < hints.size(); ++i)
+		s_blockHints[hints[i].startpc] = hints[i];
+}
+
+static void recSaveBlockHints()
+{
+	if (s_blockHints.empty() || !s_blockHintsCrc) return;
+
+	wxFFile file( GetBlockHintsFilename(s_blockHintsCrc), L"wb" );
+	if (!file.IsOpened()) return;
+
+	u32 header[4] = { BlockHintsMagic, BlockHintsVersion, s_blockHintsCrc, (u32)s_blockHints.size() };
+	file.Write(header, sizeof(header));
+
+	for (std::map<u32, BlockHint>::const_iterator it = s_blockHints.begin(); it != s_blockHints.end(); ++it)
+		file.Write(&it->second, sizeof(BlockHint));
+}
+
+// Saves the hints of the previous ELF and loads the ones of crc.  No-op if crc is current.
+static void recSwitchBlockHints(u32 crc)
+{
+	if (crc == s_blockHintsCrc) return;
+
+	recSaveBlockHints();
+	recLoadBlockHints(crc);
+	s_blockHintsNextPc = 0;
+}
+
+// Records a freshly compiled block, if it belongs to the game whose hints are loaded.
+static void recRecordBlockHint(u32 startpc, u32 size)
+{
+	if (!EmuConfig.Cpu.Recompiler.EnableEEBlockHints || !g_GameStarted || !ElfCRC) return;
+	if (ElfCRC != s_blockHintsCrc || !size || s_blockHints.size() >= BlockHintsMax) return;
+
+	BlockHint hint = { startpc, size, 0 };
+	if (BlockHintHash(startpc, size, hint.hash))
+		s_blockHints[startpc] = hint;
+}
+
+// Precompiles the next few hinted blocks; the pass is complete once the end of the set, or
+// its share of the code cache, is reached.
+static void recPrecompileBlockHints()
+{
+	recSwitchBlockHints(ElfCRC);
+
+	// Leave at least half of the cache to the game itself, so that warming up never
+	// triggers a recompiler reset.
+	const u8* budget = recMem->GetPtr() + (recMem->GetPtrEnd() - recMem->GetPtr()) / 2;
+	uint compiled = 0;
+
+	s_blockHintsWarming = true;
+
+	std::map<u32, BlockHint>::const_iterator it = s_blockHints.lower_bound(s_blockHintsNextPc);
+
+	for (; it != s_blockHints.end() && compiled < BlockHintsPerCompile; ++it)
+	{
+		const BlockHint& hint = it->second;
+		u32 hash;
+
+		if (recPtr >= budget || eeRecNeedsReset) break;
+		if (!hint.startpc || PC_GETBLOCK(hint.startpc)->GetFnptr() != (uptr)JITCompile) continue;
+		if (!BlockHintHash(hint.startpc, hint.size, hash) || hash != hint.hash) continue;
+
+		recRecompile(hint.startpc);
+		compiled++;
+	}
+
+	s_blockHintsWarming = false;
+
+	if (it == s_blockHints.end() || recPtr >= budget || eeRecNeedsReset)
+	{
+		s_blockHintsWarmedCrc = ElfCRC;
+		if (!s_blockHints.empty())
+			Console.WriteLn( Color_StrongBlack, "EE/iR5900-32 block hint warm-up done (%u hinted blocks)", (uint)s_blockHints.size() );
+	}
+	else
+		s_blockHintsNextPc = it->first;
+}
+
 ////////////////////////////////////////////////////
 static void recResetRaw()
 {
@@ -608,6 +778,8 @@ static void recResetRaw()
 
 static void recShutdown()
 {
+	recSaveBlockHints();
+
 	safe_delete( recMem );
 	safe_aligned_free( recRAMCopy );
 	safe_aligned_free( recLutReserve_RAM );
@@ -893,6 +1065,41 @@ void SetBranchImm( u32 imm )
 	iBranchTest(imm);
 }
 
+// Decides during the block scan whether the unconditional jump at 'from' can be followed
+// into its target as part of the same block.  Only forward jumps within the block's page are
+// stitched: blocks must stay within one page for memory protection, and the skipped gap only
+// makes the protected range a bit more conservative.  Cycle counts are unaffected since only
+// the instructions actually executed are compiled.
+static bool recCanStitchJump(u32 startpc, u32 from, u32 target)
+{
+	if (s_nStitchCount >= MaxStitchedJumps || EmuConfig.Gamefixes.GoemonTlbHack) return false;
+	if (target <= from + 4 || ((target ^ startpc) & ~0xfff)) return false;
+	if (isBreakpointNeeded(from + 4) != 0 || isMemcheckNeeded(from + 4) != 0) return false;
+
+	// Already compiled code at the target: simply link to it.
+	uptr fnptr = PC_GETBLOCK(target)->GetFnptr();
+	if (fnptr != (uptr)JITCompile && fnptr != (uptr)JITCompileInBlock) return false;
+
+	s_stitchFrom[s_nStitchCount] = from;
+	s_stitchTo[s_nStitchCount] = target;
+	s_nStitchCount++;
+	return true;
+}
+
+// Called by the J/B recompilers once the delay slot has been compiled.  If the block scan
+// stitched this jump, compilation continues at the target with the register allocation and
+// constant state carried over, and no branch is emitted.
+bool recStitchJump(u32 newpc)
+{
+	if (s_nStitchIdx >= s_nStitchCount) return false;
+	if (s_stitchFrom[s_nStitchIdx] + 8 != pc || s_stitchTo[s_nStitchIdx] != newpc) return false;
+
+	g_pCurInstInfo += (newpc - pc) / 4;
+	pc = newpc;
+	s_nStitchIdx++;
+	return true;
+}
+
 void SaveBranchState()
 {
 	s_savenBlockCycles = s_nBlockCycles;
@@ -1585,6 +1792,16 @@ static void __fastcall recRecompile( const u32 startpc )
 
 	if (eeRecNeedsReset) recResetRaw();
 
+	if (EmuConfig.Cpu.Recompiler.EnableEEBlockHints && g_GameStarted && ElfCRC && ElfCRC != s_blockHintsWarmedCrc && !s_blockHintsWarming)
+	{
+		recPrecompileBlockHints();
+
+		// The requested block may have been part of the hints.
+		if (PC_GETBLOCK(startpc)->GetFnptr() != (uptr)JITCompile
+			&& PC_GETBLOCK(startpc)->GetFnptr() != (uptr)JITCompileInBlock)
+			return;
+	}
+
 	xSetPtr( recPtr );
 	recPtr = xGetAlignedCallTarget();
 
@@ -1658,6 +1875,8 @@ static void __fastcall recRecompile( const u32 startpc )
 	i = startpc;
 	s_nEndBlock = 0xffffffff;
 	s_branchTo = -1;
+	s_nStitchCount = 0;
+	s_nStitchIdx = 0;
 
 	// compile breakpoints as individual blocks
 	int n1 = isBreakpointNeeded(i);
@@ -1724,11 +1943,28 @@ static void __fastcall recRecompile( const u32 startpc )
 			case 2: // J
 			case 3: // JAL
 				s_branchTo = _Target_ << 2 | (i + 4) & 0xf0000000;
+				if (_Opcode_ == 2 && recCanStitchJump(startpc, i, s_branchTo)) {
+					i = s_branchTo;
+					s_branchTo = -1;
+					continue;
+				}
 				s_nEndBlock = i + 8;
 				goto StartRecomp;
 
 			// branches
-			case 4: case 5: case 6: case 7:
+			case 4: // BEQ ($0, $0 is an unconditional B)
+				s_branchTo = _Imm_ * 4 + i + 4;
+				if (_Rs_ == 0 && _Rt_ == 0 && recCanStitchJump(startpc, i, s_branchTo)) {
+					i = s_branchTo;
+					s_branchTo = -1;
+					continue;
+				}
+				if( s_branchTo > startpc && s_branchTo < i ) s_nEndBlock = s_branchTo;
+				else  s_nEndBlock = i+8;
+
+				goto StartRecomp;
+
+			case 5: case 6: case 7:
 			case 20: case 21: case 22: case 23:
 				s_branchTo = _Imm_ * 4 + i + 4;
 				if( s_branchTo > startpc && s_branchTo < i ) s_nEndBlock = s_branchTo;
@@ -1775,7 +2011,7 @@ StartRecomp:
 	// without a significant loss in cycle accuracy is with a division, but games would probably
 	// be happy with time wasting loops completing in 0 cycles and timeouts waiting forever.
 	s_nBlockFF = false;
-	if (s_branchTo == startpc) {
+	if (s_branchTo == startpc && !s_nStitchCount) {
 		s_nBlockFF = true;
 
 		u32 reads = 0, loads = 1;
@@ -1955,6 +2191,8 @@ StartRecomp:
 	pxAssert( (pc-startpc)>>2 <= 0xffff );
 	s_pCurBlockEx->size = (pc-startpc)>>2;
 
+	recRecordBlockHint(s_pCurBlockEx->startpc, s_pCurBlockEx->size);
+
 	if (HWADDR(pc) <= Ps2MemSize::MainRam) {
 		BASEBLOCKEX *oldBlock;
 		int i;
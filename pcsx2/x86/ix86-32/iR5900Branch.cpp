@@ -224,6 +224,8 @@ void recBEQ_const()
 		branchTo = pc+4;
 
 	recompileNextInstruction(1);
+	if (recStitchJump(branchTo))
+		return;
 	SetBranchImm( branchTo );
 }
 
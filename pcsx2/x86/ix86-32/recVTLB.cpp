@@ -137,6 +137,16 @@ static void iMOV64_Smart( const xIndirectVoid& destRm, const xIndirectVoid& srcR
 	cont:
 	........
 
+	// Note on "fastmem" (direct base+offset guest accesses):
+
+	Mirroring the PS2 virtual space 1:1 in a host reservation, with the hardware register
+	and unmapped ranges left as page faults, needs a 4GB host address range.  That is the
+	entire address space of this 32-bit x86 recompiler, so it cannot be reserved here. It
+	also needs TLB remaps to become host mmap() calls on a shared-memory backing for eeMem,
+	but eeMem is allocated through a private VirtualMemoryReserve.  The lookup above
+	(shr, load, add, js) is therefore kept.  Accesses with a constant address already skip
+	it via the _Const variants below.
+
 */
 
 namespace vtlb_private
@@ -110,6 +110,7 @@ PFNGLGETPROGRAMPIPELINEIVPROC          glGetProgramPipelineiv              = NUL
 PFNGLVALIDATEPROGRAMPIPELINEPROC       glValidateProgramPipeline           = NULL;
 PFNGLGETPROGRAMPIPELINEINFOLOGPROC     glGetProgramPipelineInfoLog         = NULL;
 PFNGLGETPROGRAMBINARYPROC              glGetProgramBinary                  = NULL;
+PFNGLPROGRAMBINARYPROC                 glProgramBinary                     = NULL;
 PFNGLVIEWPORTINDEXEDFPROC              glViewportIndexedf                  = NULL;
 PFNGLVIEWPORTINDEXEDFVPROC             glViewportIndexedfv                 = NULL;
 PFNGLSCISSORINDEXEDPROC                glScissorIndexed                    = NULL;
@@ -278,6 +278,7 @@ extern   PFNGLGETPROGRAMPIPELINEIVPROC          glGetProgramPipelineiv;
 extern   PFNGLVALIDATEPROGRAMPIPELINEPROC       glValidateProgramPipeline;
 extern   PFNGLGETPROGRAMPIPELINEINFOLOGPROC     glGetProgramPipelineInfoLog;
 extern   PFNGLGETPROGRAMBINARYPROC              glGetProgramBinary;
+extern   PFNGLPROGRAMBINARYPROC                 glProgramBinary;
 extern   PFNGLVIEWPORTINDEXEDFPROC              glViewportIndexedf;
 extern   PFNGLVIEWPORTINDEXEDFVPROC             glViewportIndexedfv;
 extern   PFNGLSCISSORINDEXEDPROC                glScissorIndexed;
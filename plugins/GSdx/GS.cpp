@@ -339,6 +339,10 @@ static int _GSopen(void** dsp, const char* title, GSRendererType renderer, int t
 			if (s_gs == NULL)
 				return -1;
 
+			// Local memory transfers (and the SW texture cache) are split over these workers
+			// for every renderer, not only the SW one
+			s_gs->m_mem.SetThreads(threads);
+
 			s_renderer = renderer;
 		}
 
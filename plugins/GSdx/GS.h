@@ -1110,7 +1110,17 @@ struct alignas(32) GIFPath
 	uint32 type;
 	GSVector4i regs;
 
-	enum {TYPE_UNKNOWN, TYPE_ADONLY, TYPE_STQRGBAXYZF2, TYPE_STQRGBAXYZ2};
+	enum {TYPE_UNKNOWN, TYPE_ADONLY, TYPE_STQRGBAXYZF2, TYPE_STQRGBAXYZ2, TYPE_VERTEX};
+
+	// registers that only feed the vertex queue, a tag made of these alone cannot change PRIM or the context mid-loop
+
+	enum
+	{
+		VERTEX_REGS =
+			(1 << GIF_REG_RGBA) | (1 << GIF_REG_STQ) | (1 << GIF_REG_UV) | (1 << GIF_REG_FOG) |
+			(1 << GIF_REG_XYZF2) | (1 << GIF_REG_XYZ2) | (1 << GIF_REG_XYZF3) | (1 << GIF_REG_XYZ3) |
+			(1 << GIF_REG_NOP)
+	};
 
 	__forceinline void SetTag(const void* mem)
 	{
@@ -1149,9 +1159,8 @@ struct alignas(32) GIFPath
 				case 1: break;
 				case 2: break;
 				case 3:
-					if(regs.u32[0] == 0x00040102) type = TYPE_STQRGBAXYZF2; // many games, TODO: formats mixed with NOPs (xeno2: 040f010f02, 04010f020f, mgs3: 04010f0f02, 0401020f0f, 04010f020f)
-					if(regs.u32[0] == 0x00050102) type = TYPE_STQRGBAXYZ2; // GoW (has other crazy formats, like ...030503050103)
-					// TODO: common types with UV instead
+					if(regs.u32[0] == 0x00040102) type = TYPE_STQRGBAXYZF2; // many games
+					if(regs.u32[0] == 0x00050102) type = TYPE_STQRGBAXYZ2; // GoW
 					break;
 				case 4: break;
 				case 5: break;
@@ -1173,6 +1182,23 @@ struct alignas(32) GIFPath
 				default:
 					__assume(0);
 				}
+
+				if(type == TYPE_UNKNOWN)
+				{
+					// formats mixed with NOPs (xeno2: 040f010f02, 04010f020f, mgs3: 04010f0f02, 0401020f0f), UV instead of STQ, GoW's ...030503050103
+
+					uint32 mask = 0;
+
+					for(uint32 i = 0; i < nreg; i++)
+					{
+						mask |= 1 << regs.u8[i];
+					}
+
+					if((mask & ~VERTEX_REGS) == 0)
+					{
+						type = TYPE_VERTEX;
+					}
+				}
 			}
 		}
 	}
@@ -291,7 +291,8 @@ bool GSDeviceOGL::Create(GSWnd* wnd)
 	{
 		GL_PUSH("GSDeviceOGL::Various");
 
-		m_shader = new GSShaderOGL(theApp.GetConfigB("debug_glsl_shader"));
+		m_shader = new GSShaderOGL(theApp.GetConfigB("debug_glsl_shader"),
+				theApp.GetConfigB("shader_cache") ? theApp.GetConfigS("shader_cache_dir") : "");
 
 		glGenFramebuffers(1, &m_fbo);
 		// Always write to the first buffer
@@ -539,6 +540,79 @@ void GSDeviceOGL::CreateTextureFX()
 
 	// Help to debug FS in apitrace
 	m_apitrace = CompilePS(PSSelector());
+
+	PrewarmPS();
+}
+
+// List of the PS selectors seen in previous sessions, first entry is the version.
+// Bump it when the PSSelector layout changes.
+#define PS_SELECTOR_LIST_VERSION 1
+
+void GSDeviceOGL::PrewarmPS()
+{
+	const std::string& dir = m_shader->GetCacheDir();
+	if (dir.empty()) return;
+
+	std::string path = dir + "/ps_selectors.bin";
+
+	// Only program binaries are loaded here, nothing is compiled from source.  A selector
+	// whose binary is missing (new driver, shader change...) is left to SetupPipeline,
+	// which compiles it the first time it is actually drawn.
+	FILE* fp = fopen(path.c_str(), "rb");
+	uint64 key = 0;
+
+	if (fp != NULL && fread(&key, sizeof(key), 1, fp) == 1 && key == PS_SELECTOR_LIST_VERSION) {
+		int loaded = 0, missed = 0;
+
+		while (fread(&key, sizeof(key), 1, fp) == 1) {
+			PSSelector sel;
+			sel.key = key;
+
+			m_ps_listed.insert(key);
+
+			if (m_ps.find(sel) != m_ps.end())
+				continue;
+
+			GLuint ps = LoadCachedPS(sel);
+			if (ps) {
+				m_ps[sel] = ps;
+				loaded++;
+			} else {
+				missed++;
+			}
+		}
+
+		fclose(fp);
+
+		fprintf(stdout, "GSdx: %d pixel shaders prewarmed from %s (%d not cached)\n", loaded, dir.c_str(), missed);
+		return;
+	}
+
+	if (fp != NULL)
+		fclose(fp);
+
+	// Missing or outdated list, start a new one
+	fp = fopen(path.c_str(), "wb");
+	if (fp == NULL) return;
+
+	key = PS_SELECTOR_LIST_VERSION;
+	fwrite(&key, sizeof(key), 1, fp);
+	fclose(fp);
+}
+
+void GSDeviceOGL::RecordPS(PSSelector sel)
+{
+	const std::string& dir = m_shader->GetCacheDir();
+	if (dir.empty()) return;
+
+	if (!m_ps_listed.insert(sel.key).second) return;
+
+	FILE* fp = fopen((dir + "/ps_selectors.bin").c_str(), "ab");
+	if (fp == NULL) return;
+
+	uint64 key = sel.key;
+	fwrite(&key, sizeof(key), 1, fp);
+	fclose(fp);
 }
 
 bool GSDeviceOGL::Reset(int w, int h)
@@ -886,10 +960,9 @@ GLuint GSDeviceOGL::CompileGS(GSSelector sel)
 		return m_shader->Compile("tfx_vgs.glsl", "gs_main", GL_GEOMETRY_SHADER, tfx_vgs_glsl, macro);
 }
 
-/* Note: must be here because tfx_glsl is static */
-GLuint GSDeviceOGL::CompilePS(PSSelector sel)
+std::string GSDeviceOGL::GetPSMacro(PSSelector sel)
 {
-	std::string macro = format("#define PS_FST %d\n", sel.fst)
+	return format("#define PS_FST %d\n", sel.fst)
 		+ format("#define PS_WMS %d\n", sel.wms)
 		+ format("#define PS_WMT %d\n", sel.wmt)
 		+ format("#define PS_TEX_FMT %d\n", sel.tex_fmt)
@@ -921,7 +994,12 @@ GLuint GSDeviceOGL::CompilePS(PSSelector sel)
 		+ format("#define PS_FBMASK %d\n", sel.fbmask)
 		+ format("#define PS_HDR %d\n", sel.hdr)
 		+ format("#define PS_PABE %d\n", sel.pabe);
-	;
+}
+
+/* Note: must be here because tfx_glsl is static */
+GLuint GSDeviceOGL::CompilePS(PSSelector sel)
+{
+	std::string macro = GetPSMacro(sel);
 
 	if (GLLoader::buggy_sso_dual_src)
 		return m_shader->CompileShader("tfx.glsl", "ps_main", GL_FRAGMENT_SHADER, tfx_fs_all_glsl, macro);
@@ -929,6 +1007,15 @@ GLuint GSDeviceOGL::CompilePS(PSSelector sel)
 		return m_shader->Compile("tfx.glsl", "ps_main", GL_FRAGMENT_SHADER, tfx_fs_all_glsl, macro);
 }
 
+// Returns 0 when the program binary isn't cached (or can't be, see CompilePS)
+GLuint GSDeviceOGL::LoadCachedPS(PSSelector sel)
+{
+	if (GLLoader::buggy_sso_dual_src)
+		return 0;
+
+	return m_shader->LoadCached("ps_main", GL_FRAGMENT_SHADER, tfx_fs_all_glsl, GetPSMacro(sel));
+}
+
 void GSDeviceOGL::SelfShaderTestRun(const string& dir, const string& file, const PSSelector& sel, int& nb_shader)
 {
 #ifdef __unix__
@@ -1704,6 +1791,7 @@ void GSDeviceOGL::SetupPipeline(const VSSelector& vsel, const GSSelector& gsel,
 	if (i == m_ps.end()) {
 		ps = CompilePS(psel);
 		m_ps[psel] = ps;
+		RecordPS(psel);
 	} else {
 		ps = i->second;
 	}
@@ -461,6 +461,7 @@ public:
 	GLuint m_ps_ss[1<<4];
 	GSDepthStencilOGL* m_om_dss[1<<5];
 	hash_map<uint64, GLuint > m_ps;
+	hash_set<uint64> m_ps_listed; // Selectors already in ps_selectors.bin
 	GLuint m_apitrace;
 
 	GLuint m_palette_ss;
@@ -555,7 +556,11 @@ public:
 	void CreateTextureFX();
 	GLuint CompileVS(VSSelector sel);
 	GLuint CompileGS(GSSelector sel);
+	std::string GetPSMacro(PSSelector sel);
 	GLuint CompilePS(PSSelector sel);
+	GLuint LoadCachedPS(PSSelector sel);
+	void PrewarmPS();
+	void RecordPS(PSSelector sel);
 	GLuint CreateSampler(bool bilinear, bool tau, bool tav, bool aniso = false);
 	GLuint CreateSampler(PSSamplerSelector sel);
 	GSDepthStencilOGL* CreateDepthStencil(OMDepthStencilSelector dssel);
@@ -23,6 +23,7 @@
 
 #include "GS.h"
 #include "GSCodeBuffer.h"
+#include "GSPerfMon.h"
 #include "xbyak/xbyak.h"
 #include "xbyak/xbyak_util.h"
 
@@ -193,6 +194,8 @@ public:
 
 			m_cgmap[key] = ret;
 
+			GSPerfMon::s_compile++;
+
 			#ifdef ENABLE_VTUNE
 
 			// vtune method registration
@@ -26,6 +26,7 @@
 
 #include "stdafx.h"
 #include "GSLocalMemory.h"
+#include "GSThread_CXX11.h"
 
 #define ASSERT_BLOCK(r, w, h) \
 	ASSERT((r).width() >= w && (r).height() >= h && !((r).left & (w - 1)) && !((r).top & (h - 1)) && !((r).right & (w - 1)) && !((r).bottom & (h - 1))); \
@@ -45,6 +46,47 @@
 
 #define FOREACH_BLOCK_END }}
 
+// minimum size of the source data handed to one worker
+
+#define WRITE_IMAGE_MT_BAND (32 * 1024)
+
+class GSLocalMemory::GSWorker : public GSJobQueue<GSLocalMemory::Job*, 16>
+{
+public:
+	virtual ~GSWorker()
+	{
+		Wait();
+	}
+
+	int GetPixels(bool reset)
+	{
+		return 0;
+	}
+
+	// GSJobQueue
+
+	void Process(GSLocalMemory::Job*& item)
+	{
+		item->Run();
+	}
+};
+
+class GSWriteImageBlockJob : public GSLocalMemory::Job
+{
+public:
+	GSLocalMemory* mem;
+	GSLocalMemory::writeImageBlock wib;
+	int l, r, y, h;
+	const uint8* src;
+	int srcpitch;
+	GIFRegBITBLTBUF BITBLTBUF;
+
+	void Run()
+	{
+		(mem->*wib)(l, r, y, h, src, srcpitch, BITBLTBUF);
+	}
+};
+
 //
 
 uint32 GSLocalMemory::pageOffset32[32][32][64];
@@ -457,6 +499,8 @@ GSLocalMemory::GSLocalMemory()
 
 GSLocalMemory::~GSLocalMemory()
 {
+	SetThreads(0);
+
 	vmfree(m_vm8, m_vmsize * 2);
 
 	for_each(m_omap.begin(), m_omap.end(), aligned_free_second());
@@ -469,6 +513,52 @@ GSLocalMemory::~GSLocalMemory()
 	}
 }
 
+void GSLocalMemory::SetThreads(int threads)
+{
+	threads = std::max<int>(threads, 0);
+
+	while((int)m_workers.size() > threads)
+	{
+		delete m_workers.back();
+
+		m_workers.pop_back();
+	}
+
+	while((int)m_workers.size() < threads)
+	{
+		m_workers.push_back(new GSWorker());
+	}
+}
+
+void GSLocalMemory::Run(Job** jobs, int count)
+{
+	// the last job runs on the calling thread, the rest are spread over the workers
+
+	int n = std::min<int>(count - 1, m_workers.size());
+
+	for(int i = 0; i < count - 1; i++)
+	{
+		if(n > 0)
+		{
+			m_workers[i % n]->Push(jobs[i]);
+		}
+		else
+		{
+			jobs[i]->Run();
+		}
+	}
+
+	if(count > 0)
+	{
+		jobs[count - 1]->Run();
+	}
+
+	for(int i = 0; i < n; i++)
+	{
+		m_workers[i]->Wait();
+	}
+}
+
 GSOffset* GSLocalMemory::GetOffset(uint32 bp, uint32 bw, uint32 psm)
 {
 	uint32 hash = bp | (bw << 14) | (psm << 20);
@@ -740,6 +830,49 @@ void GSLocalMemory::WriteImageBlock(int l, int r, int y, int h, const uint8* src
 	}
 }
 
+template<int psm, int bsx, int bsy, int alignment>
+void GSLocalMemory::WriteImageBlockMT(int l, int r, int y, int h, const uint8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF)
+{
+	// block rows never share a block, split them into bands and let the workers swizzle all but
+	// the last one, which stays on this thread. everything is written by the time we return, so
+	// the callers' page tracking (GSRendererSW::InvalidateVideoMem) does not have to change.
+
+	int bands = std::min<int>(m_workers.size() + 1, std::min<int>(h / bsy, srcpitch * h / WRITE_IMAGE_MT_BAND));
+
+	if(bands < 2)
+	{
+		WriteImageBlock<psm, bsx, bsy, alignment>(l, r, y, h, src, srcpitch, BITBLTBUF);
+
+		return;
+	}
+
+	int step = (h / bsy + bands - 1) / bands * bsy;
+
+	vector<GSWriteImageBlockJob> jobs(bands);
+	vector<Job*> ptrs(bands);
+
+	int n = 0;
+
+	for(; h > 0; h -= step, y += step, src += srcpitch * step, n++)
+	{
+		GSWriteImageBlockJob& job = jobs[n];
+
+		job.mem = this;
+		job.wib = &GSLocalMemory::WriteImageBlock<psm, bsx, bsy, alignment>;
+		job.l = l;
+		job.r = r;
+		job.y = y;
+		job.h = std::min<int>(h, step);
+		job.src = src;
+		job.srcpitch = srcpitch;
+		job.BITBLTBUF = BITBLTBUF;
+
+		ptrs[n] = &job;
+	}
+
+	Run(ptrs.data(), n);
+}
+
 template<int psm, int bsx, int bsy>
 void GSLocalMemory::WriteImageLeftRight(int l, int r, int y, int h, const uint8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF)
 {
@@ -998,15 +1131,15 @@ void GSLocalMemory::WriteImage(int& tx, int& ty, const uint8* src, int len, GIFR
 
 					if((addr & 31) == 0 && (srcpitch & 31) == 0)
 					{
-						WriteImageBlock<psm, bsx, bsy, 32>(la, ra, ty, h2, s, srcpitch, BITBLTBUF);
+						WriteImageBlockMT<psm, bsx, bsy, 32>(la, ra, ty, h2, s, srcpitch, BITBLTBUF);
 					}
 					else if((addr & 15) == 0 && (srcpitch & 15) == 0)
 					{
-						WriteImageBlock<psm, bsx, bsy, 16>(la, ra, ty, h2, s, srcpitch, BITBLTBUF);
+						WriteImageBlockMT<psm, bsx, bsy, 16>(la, ra, ty, h2, s, srcpitch, BITBLTBUF);
 					}
 					else
 					{
-						WriteImageBlock<psm, bsx, bsy, 0>(la, ra, ty, h2, s, srcpitch, BITBLTBUF);
+						WriteImageBlockMT<psm, bsx, bsy, 0>(la, ra, ty, h2, s, srcpitch, BITBLTBUF);
 					}
 
 					s += srcpitch * h2;
@@ -90,6 +90,7 @@ public:
 	typedef void (GSLocalMemory::*writeFrameAddr)(uint32 addr, uint32 c);
 	typedef uint32 (GSLocalMemory::*readPixelAddr)(uint32 addr) const;
 	typedef uint32 (GSLocalMemory::*readTexelAddr)(uint32 addr, const GIFRegTEXA& TEXA) const;
+	typedef void (GSLocalMemory::*writeImageBlock)(int l, int r, int y, int h, const uint8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
 	typedef void (GSLocalMemory::*writeImage)(int& tx, int& ty, const uint8* src, int len, GIFRegBITBLTBUF& BITBLTBUF, GIFRegTRXPOS& TRXPOS, GIFRegTRXREG& TRXREG);
 	typedef void (GSLocalMemory::*readImage)(int& tx, int& ty, uint8* dst, int len, GIFRegBITBLTBUF& BITBLTBUF, GIFRegTRXPOS& TRXPOS, GIFRegTRXREG& TRXREG) const;
 	typedef void (GSLocalMemory::*readTexture)(const GSOffset* RESTRICT off, const GSVector4i& r, uint8* dst, int dstpitch, const GIFRegTEXA& TEXA);
@@ -175,10 +176,25 @@ protected:
 	hash_map<uint32, GSPixelOffset4*> m_po4map;
 	hash_map<uint64, vector<GSVector2i>*> m_p2tmap;
 
+	class GSWorker;
+
+	vector<GSWorker*> m_workers;
+
 public:
+	class Job
+	{
+	public:
+		virtual ~Job() {}
+		virtual void Run() = 0;
+	};
+
 	GSLocalMemory();
 	virtual ~GSLocalMemory();
 
+	void SetThreads(int threads);
+	int GetThreads() const {return (int)m_workers.size();}
+	void Run(Job** jobs, int count);
+
 	GSOffset* GetOffset(uint32 bp, uint32 bw, uint32 psm);
 	GSPixelOffset* GetPixelOffset(const GIFRegFRAME& FRAME, const GIFRegZBUF& ZBUF);
 	GSPixelOffset4* GetPixelOffset4(const GIFRegFRAME& FRAME, const GIFRegZBUF& ZBUF);
@@ -853,6 +869,9 @@ public:
 	template<int psm, int bsx, int bsy, int alignment>
 	void WriteImageBlock(int l, int r, int y, int h, const uint8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
 
+	template<int psm, int bsx, int bsy, int alignment>
+	void WriteImageBlockMT(int l, int r, int y, int h, const uint8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
+
 	template<int psm, int bsx, int bsy>
 	void WriteImageLeftRight(int l, int r, int y, int h, const uint8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
 
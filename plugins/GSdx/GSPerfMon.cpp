@@ -22,15 +22,36 @@
 #include "stdafx.h"
 #include "GSPerfMon.h"
 
+std::atomic<int> GSPerfMon::s_compile(0);
+
+const char* GSPerfMon::m_names[CounterLast] =
+{
+	"frame_ms", "prim", "draw", "swizzle", "unswizzle", "fillrate", "quad", "sync_point", "texture_upload", "texture_upload_wait",
+	"readback", "readback_avoided", "draw_merged", "tc_hit", "tc_miss", "compile", "sync_wait_ms",
+};
+
 GSPerfMon::GSPerfMon()
 	: m_frame(0)
 	, m_lastframe(0)
 	, m_count(0)
+	, m_history_pos(0)
+	, m_history_count(0)
+	, m_log(NULL)
+	, m_log_json(false)
 {
 	memset(m_counters, 0, sizeof(m_counters));
 	memset(m_stats, 0, sizeof(m_stats));
 	memset(m_total, 0, sizeof(m_total));
 	memset(m_begin, 0, sizeof(m_begin));
+	memset(m_current, 0, sizeof(m_current));
+}
+
+GSPerfMon::~GSPerfMon()
+{
+	if(m_log)
+	{
+		fclose(m_log);
+	}
 }
 
 void GSPerfMon::Put(counter_t c, double val)
@@ -48,11 +69,34 @@ void GSPerfMon::Put(counter_t c, double val)
 		clock_t now = clock();
 #endif
 
+		int compile = s_compile.exchange(0);
+
+		m_counters[Compile] += compile;
+		m_current[Compile] += compile;
+
 		if(m_lastframe != 0)
 		{
-			m_counters[c] += (now - m_lastframe) * 1000 / CLOCKS_PER_SEC;
+			double ms = (now - m_lastframe) * 1000 / CLOCKS_PER_SEC;
+
+			m_counters[c] += ms;
+			m_current[c] = ms;
+
+			frame_t& f = m_history[m_history_pos];
+
+			f.frame = m_frame;
+			memcpy(f.counters, m_current, sizeof(m_current));
+
+			m_history_pos = (m_history_pos + 1) % FrameHistory;
+			m_history_count = std::min<int>(m_history_count + 1, FrameHistory);
+
+			if(m_log)
+			{
+				WriteFrame(m_log, f, m_log_json);
+			}
 		}
 
+		memset(m_current, 0, sizeof(m_current));
+
 		m_lastframe = now;
 		m_frame++;
 		m_count++;
@@ -60,10 +104,141 @@ void GSPerfMon::Put(counter_t c, double val)
 	else
 	{
 		m_counters[c] += val;
+		m_current[c] += val;
 	}
 #endif
 }
 
+const GSPerfMon::frame_t* GSPerfMon::GetHistory(int i) const
+{
+	// 0 is the oldest frame still in the ring
+
+	if(i < 0 || i >= m_history_count)
+	{
+		return NULL;
+	}
+
+	return &m_history[(m_history_pos - m_history_count + i + FrameHistory) % FrameHistory];
+}
+
+void GSPerfMon::WriteHeader(FILE* fp)
+{
+	fprintf(fp, "frame");
+
+	for(int i = 0; i < CounterLast; i++)
+	{
+		fprintf(fp, ",%s", m_names[i]);
+	}
+
+	fprintf(fp, "\n");
+}
+
+void GSPerfMon::WriteFrame(FILE* fp, const frame_t& f, bool json)
+{
+	if(json)
+	{
+		fprintf(fp, "{\"frame\":%llu", (unsigned long long)f.frame);
+
+		for(int i = 0; i < CounterLast; i++)
+		{
+			fprintf(fp, ",\"%s\":%g", m_names[i], f.counters[i]);
+		}
+
+		fprintf(fp, "}\n");
+	}
+	else
+	{
+		fprintf(fp, "%llu", (unsigned long long)f.frame);
+
+		for(int i = 0; i < CounterLast; i++)
+		{
+			fprintf(fp, ",%g", f.counters[i]);
+		}
+
+		fprintf(fp, "\n");
+	}
+}
+
+static bool IsJson(const string& fn)
+{
+	return fn.size() >= 5 && fn.compare(fn.size() - 5, 5, ".json") == 0;
+}
+
+bool GSPerfMon::Dump(const string& fn) const
+{
+	// the whole ring, a json file gets one array, anything else is csv
+
+	FILE* fp = fopen(fn.c_str(), "w");
+
+	if(fp == NULL)
+	{
+		return false;
+	}
+
+	bool json = IsJson(fn);
+
+	if(json)
+	{
+		fprintf(fp, "[\n");
+	}
+	else
+	{
+		WriteHeader(fp);
+	}
+
+	for(int i = 0; i < m_history_count; i++)
+	{
+		if(json && i > 0)
+		{
+			fprintf(fp, ",");
+		}
+
+		WriteFrame(fp, *GetHistory(i), json);
+	}
+
+	if(json)
+	{
+		fprintf(fp, "]\n");
+	}
+
+	fclose(fp);
+
+	return true;
+}
+
+bool GSPerfMon::Log(const string& fn)
+{
+	// appends every finished frame, one json object per line for .json, csv otherwise
+
+	if(m_log)
+	{
+		fclose(m_log);
+
+		m_log = NULL;
+	}
+
+	if(fn.empty())
+	{
+		return true;
+	}
+
+	m_log = fopen(fn.c_str(), "w");
+
+	if(m_log == NULL)
+	{
+		return false;
+	}
+
+	m_log_json = IsJson(fn);
+
+	if(!m_log_json)
+	{
+		WriteHeader(m_log);
+	}
+
+	return true;
+}
+
 void GSPerfMon::Update()
 {
 #ifndef DISABLE_PERF_MON
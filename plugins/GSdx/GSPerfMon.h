@@ -35,10 +35,23 @@ public:
 	
 	enum counter_t 
 	{
-		Frame, Prim, Draw, Swizzle, Unswizzle, Fillrate, Quad, SyncPoint,
+		Frame, Prim, Draw, Swizzle, Unswizzle, Fillrate, Quad, SyncPoint, TextureUpload, TextureUploadWait, Readback, ReadbackAvoided, DrawMerged,
+		TextureCacheHit, TextureCacheMiss, Compile, SyncWait,
 		CounterLast,
 	};
 
+	enum {FrameHistory = 1024};
+
+	struct frame_t
+	{
+		uint64 frame;
+		double counters[CounterLast];
+	};
+
+	// bumped by the function maps, which may compile on a worker thread, Put(Frame) moves it into Compile
+
+	static std::atomic<int> s_compile;
+
 protected:
 	double m_counters[CounterLast];
 	double m_stats[CounterLast];
@@ -47,10 +60,23 @@ protected:
 	clock_t m_lastframe;
 	int m_count;
 
+	double m_current[CounterLast];
+	frame_t m_history[FrameHistory];
+	int m_history_pos;
+	int m_history_count;
+	FILE* m_log;
+	bool m_log_json;
+
+	static const char* m_names[CounterLast];
+
+	static void WriteHeader(FILE* fp);
+	static void WriteFrame(FILE* fp, const frame_t& f, bool json);
+
 	friend class GSPerfMonAutoTimer;
 
 public:
 	GSPerfMon();
+	virtual ~GSPerfMon();
 
 	void SetFrame(uint64 frame) {m_frame = frame;}
 	uint64 GetFrame() {return m_frame;}
@@ -59,6 +85,11 @@ public:
 	double Get(counter_t c) {return m_stats[c];}
 	void Update();
 
+	const frame_t* GetHistory(int i) const;
+	int GetHistoryCount() const {return m_history_count;}
+	bool Dump(const string& fn) const;
+	bool Log(const string& fn);
+
 	void Start(int timer = Main);
 	void Stop(int timer = Main);
 	int CPU(int timer = Main, bool reset = true);
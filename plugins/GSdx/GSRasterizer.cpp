@@ -1174,12 +1174,15 @@ void GSRasterizerList::Sync()
 {
 	if(!IsSynced())
 	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
 		for(size_t i = 0; i < m_workers.size(); i++)
 		{
 			m_workers[i]->Wait();
 		}
 
 		m_perfmon->Put(GSPerfMon::SyncPoint, 1);
+		m_perfmon->Put(GSPerfMon::SyncWait, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
 	}
 }
 
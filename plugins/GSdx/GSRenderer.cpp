@@ -50,6 +50,8 @@ GSRenderer::GSRenderer()
 	m_fxaa        = theApp.GetConfigB("fxaa");
 	m_shaderfx    = theApp.GetConfigB("shaderfx");
 	m_shadeboost  = theApp.GetConfigB("ShadeBoost");
+
+	m_perfmon.Log(theApp.GetConfigS("perfmon_log"));
 }
 
 GSRenderer::~GSRenderer()
@@ -410,6 +412,26 @@ void GSRenderer::VSync(int field)
 
 				s += format(" | %d%% CPU", sum);
 			}
+
+			// Only shown when non zero, the perfmon dump (End key) has the full per frame history
+			static const struct {GSPerfMon::counter_t counter; double scale; const char* fmt;} extra[] =
+			{
+				{GSPerfMon::TextureUpload, 1.0 / 1024, " | %.2f KB uploaded"},
+				{GSPerfMon::TextureUploadWait, 1, " | %.2f upload waits"},
+				{GSPerfMon::DrawMerged, 1, " | %.0f draws merged"},
+				{GSPerfMon::Readback, 1, " | %.2f readbacks"},
+				{GSPerfMon::ReadbackAvoided, 1, " | %.2f readbacks skipped"},
+			};
+
+			for(const auto& e : extra)
+			{
+				double value = m_perfmon.Get(e.counter);
+
+				if(value > 0)
+				{
+					s += format(e.fmt, value * e.scale);
+				}
+			}
 		}
 		else
 		{
@@ -569,6 +591,16 @@ void GSRenderer::EndCapture()
 	m_capture.EndCapture();
 }
 
+void GSRenderer::DumpPerfMon()
+{
+	string fn = format("GSdx_perfmon_%lld.%s", m_perfmon.GetFrame(), theApp.GetConfigB("perfmon_json") ? "json" : "csv");
+
+	if(m_perfmon.Dump(fn))
+	{
+		printf("GSdx: Saved the last %d frames of counters to %s.\n", m_perfmon.GetHistoryCount(), fn.c_str());
+	}
+}
+
 void GSRenderer::KeyEvent(GSKeyEventData* e)
 {
 #ifdef _WIN32
@@ -607,6 +639,9 @@ void GSRenderer::KeyEvent(GSKeyEventData* e)
 			m_shaderfx = !m_shaderfx;
 			printf("GSdx: External post-processing is now %s.\n", m_shaderfx ? "enabled" : "disabled");
 			return;
+		case VK_END:
+			DumpPerfMon();
+			return;
 		}
 
 	}
@@ -645,6 +680,9 @@ void GSRenderer::KeyEvent(GSKeyEventData* e)
 			m_shaderfx = !m_shaderfx;
 			printf("GSdx: External post-processing is now %s.\n", m_shaderfx ? "enabled" : "disabled");
 			return;
+		case XK_End:
+			DumpPerfMon();
+			return;
 		case XK_Shift_L:
 		case XK_Shift_R:
 			m_shift_key = true;
@@ -33,6 +33,7 @@ class GSRenderer : public GSState
 	int m_shader;
 
 	bool Merge(int field);
+	void DumpPerfMon();
 
 	// Only used on linux
 	bool m_shift_key;
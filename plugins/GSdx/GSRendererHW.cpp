@@ -567,6 +567,11 @@ void GSRendererHW::Draw()
 	// The rectangle of the draw
 	GSVector4i r = GSVector4i(m_vt.m_min.p.xyxy(m_vt.m_max.p)).rintersect(GSVector4i(context->scissor.in));
 
+	// The targets are about to change, even if a hack below skips the draw (the OI hacks
+	// and OI_BlitFMV write them directly), so the local memory no longer mirrors them
+	if (rt) rt->m_readback = GSVector4i::zero();
+	if (ds) ds->m_readback = GSVector4i::zero();
+
 	if(m_hacks.m_oi && !(this->*m_hacks.m_oi)(rt_tex, ds_tex, tex))
 	{
 		s_n += 1; // keep counter sync
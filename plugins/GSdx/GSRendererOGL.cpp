@@ -60,6 +60,19 @@ bool GSRendererOGL::CreateDevice(GSDevice* dev)
 	return true;
 }
 
+void GSRendererOGL::VSync(int field)
+{
+	uint64 upload_byte;
+	uint32 fence_wait;
+
+	PboPool::GetStats(upload_byte, fence_wait);
+
+	m_perfmon.Put(GSPerfMon::TextureUpload, (double)upload_byte);
+	m_perfmon.Put(GSPerfMon::TextureUploadWait, fence_wait);
+
+	GSRendererHW::VSync(field);
+}
+
 void GSRendererOGL::Lines2Sprites()
 {
 	if (m_vt.m_primclass != GS_SPRITE_CLASS) return;
@@ -86,6 +86,8 @@ class GSRendererOGL final : public GSRendererHW
 
 		bool CreateDevice(GSDevice* dev);
 
+		void VSync(int field) final;
+
 		void DrawPrims(GSTexture* rt, GSTexture* ds, GSTextureCache::Source* tex) final;
 
 		PRIM_OVERLAP PrimitiveOverlap();
@@ -22,13 +22,32 @@
 #include "stdafx.h"
 #include "GSShaderOGL.h"
 #include "GLState.h"
+#include "GSUtil.h"
 
 #include "res/glsl_source.h"
 
-GSShaderOGL::GSShaderOGL(bool debug) :
+GSShaderOGL::GSShaderOGL(bool debug, const std::string& cache_dir) :
 	m_pipeline(0),
-	m_debug_shader(debug)
+	m_debug_shader(debug),
+	m_cache_seed(0)
 {
+	// The cache is only useful if the driver can load back at least one binary format
+	GLint formats = 0;
+	if (glGetProgramBinary && glProgramBinary)
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+
+	if (!cache_dir.empty() && formats > 0) {
+		m_cache_dir = cache_dir;
+		GSmkdir(m_cache_dir.c_str());
+
+		const char* driver[3] = {
+			(const char*)glGetString(GL_VENDOR),
+			(const char*)glGetString(GL_RENDERER),
+			(const char*)glGetString(GL_VERSION)
+		};
+		m_cache_seed = CacheKey(driver, countof(driver));
+	}
+
 	// Create a default pipeline
 	m_pipeline = LinkPipeline("HW pipe", 0, 0, 0);
 	BindPipeline(m_pipeline);
@@ -264,10 +283,39 @@ GLuint GSShaderOGL::Compile(const std::string& glsl_file, const std::string& ent
 	sources[1] = common_header_glsl;
 	sources[2] = glsl_h_code;
 
-	program = glCreateShaderProgramv(type, shader_nb, sources);
+	uint64 key = 0;
+
+	if (!m_cache_dir.empty()) {
+		key = CacheKey(sources, shader_nb);
+
+		program = LoadProgramBinary(key);
+		if (program) {
+			m_prog_to_delete.push_back(program);
+			return program;
+		}
+
+		// Same as glCreateShaderProgramv but the binary must be flagged as retrievable before the link
+		GLuint shader = glCreateShader(type);
+		glShaderSource(shader, shader_nb, sources, NULL);
+		glCompileShader(shader);
+		ValidateShader(shader);
+
+		program = glCreateProgram();
+		glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		glAttachShader(program, shader);
+		glLinkProgram(program);
+		glDetachShader(program, shader);
+		glDeleteShader(shader);
+	} else {
+		program = glCreateShaderProgramv(type, shader_nb, sources);
+	}
 
 	bool status = ValidateProgram(program);
 
+	if (!m_cache_dir.empty())
+		SaveProgramBinary(key, program);
+
 	if (!status) {
 		// print extra info
 		fprintf(stderr, "%s (entry %s, prog %d) :", glsl_file.c_str(), entry.c_str(), program);
@@ -280,6 +328,29 @@ GLuint GSShaderOGL::Compile(const std::string& glsl_file, const std::string& ent
 	return program;
 }
 
+GLuint GSShaderOGL::LoadCached(const std::string& entry, GLenum type, const char* glsl_h_code, const std::string& macro_sel)
+{
+	ASSERT(glsl_h_code != NULL);
+
+	if (m_cache_dir.empty())
+		return 0;
+
+	const int shader_nb = 3;
+	const char* sources[shader_nb];
+
+	std::string header = GenGlslHeader(entry, type, macro_sel);
+
+	sources[0] = header.c_str();
+	sources[1] = common_header_glsl;
+	sources[2] = glsl_h_code;
+
+	GLuint program = LoadProgramBinary(CacheKey(sources, shader_nb));
+	if (program)
+		m_prog_to_delete.push_back(program);
+
+	return program;
+}
+
 // Same as above but for not-separated build
 GLuint GSShaderOGL::CompileShader(const std::string& glsl_file, const std::string& entry, GLenum type, const char* glsl_h_code, const std::string& macro_sel)
 {
@@ -316,6 +387,111 @@ GLuint GSShaderOGL::CompileShader(const std::string& glsl_file, const std::strin
 	return shader;
 }
 
+uint64 GSShaderOGL::CacheKey(const char* const* sources, int count) const
+{
+	// FNV-1a, the terminating nul is hashed too so that the string boundaries matter
+	uint64 h = 0xcbf29ce484222325ull ^ m_cache_seed;
+
+	for (int i = 0; i < count; i++) {
+		const char* s = sources[i] ? sources[i] : "";
+		do {
+			h = (h ^ (uint8)*s) * 0x100000001b3ull;
+		} while (*s++);
+	}
+
+	return h;
+}
+
+std::string GSShaderOGL::CachePath(uint64 key) const
+{
+	return format("%s/%016llx.bin", m_cache_dir.c_str(), (unsigned long long)key);
+}
+
+struct ProgramBinaryHeader
+{
+	enum {MAGIC = 0x42505347, VERSION = 1}; // "GSPB"
+
+	uint32 magic;
+	uint32 version;
+	uint64 key;
+	uint32 format;
+	uint32 size;
+};
+
+GLuint GSShaderOGL::LoadProgramBinary(uint64 key)
+{
+	std::string path = CachePath(key);
+
+	FILE* fp = fopen(path.c_str(), "rb");
+	if (fp == NULL) return 0;
+
+	ProgramBinaryHeader header;
+	std::vector<char> binary;
+
+	bool valid = fread(&header, sizeof(header), 1, fp) == 1
+		&& header.magic == ProgramBinaryHeader::MAGIC
+		&& header.version == ProgramBinaryHeader::VERSION
+		&& header.key == key
+		&& header.size > 0;
+
+	if (valid) {
+		binary.resize(header.size);
+		valid = fread(binary.data(), header.size, 1, fp) == 1;
+	}
+
+	fclose(fp);
+
+	GLuint p = 0;
+	GLint status = 0;
+
+	if (valid) {
+		p = glCreateProgram();
+		glProgramParameteri(p, GL_PROGRAM_SEPARABLE, GL_TRUE);
+		glProgramBinary(p, header.format, binary.data(), header.size);
+		glGetProgramiv(p, GL_LINK_STATUS, &status);
+	}
+
+	if (!status) {
+		// Truncated file or binary refused by the driver, it will be rebuilt
+		if (p) glDeleteProgram(p);
+		remove(path.c_str());
+		return 0;
+	}
+
+	return p;
+}
+
+void GSShaderOGL::SaveProgramBinary(uint64 key, GLuint p)
+{
+	GLint status = 0;
+	glGetProgramiv(p, GL_LINK_STATUS, &status);
+	if (!status) return;
+
+	GLint length = 0;
+	glGetProgramiv(p, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0) return;
+
+	std::vector<char> binary(length);
+	GLenum binary_format = 0;
+	glGetProgramBinary(p, length, NULL, &binary_format, binary.data());
+
+	ProgramBinaryHeader header;
+	header.magic = ProgramBinaryHeader::MAGIC;
+	header.version = ProgramBinaryHeader::VERSION;
+	header.key = key;
+	header.format = binary_format;
+	header.size = length;
+
+	std::string path = CachePath(key);
+
+	FILE* fp = fopen(path.c_str(), "wb");
+	if (fp == NULL) return;
+
+	fwrite(&header, sizeof(header), 1, fp);
+	fwrite(binary.data(), length, 1, fp);
+	fclose(fp);
+}
+
 // This function will get the binary program. Normally it must be used a caching
 // solution but Nvidia also incorporates the ASM dump. Asm is nice because it allow
 // to have an overview of the program performance based on the instruction number
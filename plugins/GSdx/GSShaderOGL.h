@@ -30,6 +30,17 @@ class GSShaderOGL {
 	std::vector<GLuint> m_prog_to_delete;
 	std::vector<GLuint> m_pipe_to_delete;
 
+	// On disk program binary cache (empty dir = disabled). Files are keyed by a hash of the
+	// driver strings and of the full shader source, so a driver update or a shader change
+	// just misses.
+	std::string m_cache_dir;
+	uint64 m_cache_seed;
+
+	uint64 CacheKey(const char* const* sources, int count) const;
+	std::string CachePath(uint64 key) const;
+	GLuint LoadProgramBinary(uint64 key);
+	void SaveProgramBinary(uint64 key, GLuint p);
+
 	bool ValidateShader(GLuint s);
 	bool ValidateProgram(GLuint p);
 	bool ValidatePipeline(GLuint p);
@@ -37,13 +48,15 @@ class GSShaderOGL {
 	std::string GenGlslHeader(const std::string& entry, GLenum type, const std::string& macro);
 
 	public:
-	GSShaderOGL(bool debug);
+	GSShaderOGL(bool debug, const std::string& cache_dir = "");
 	~GSShaderOGL();
 
 	void BindPipeline(GLuint vs, GLuint gs, GLuint ps);
 	void BindPipeline(GLuint pipe);
 
 	GLuint Compile(const std::string& glsl_file, const std::string& entry, GLenum type, const char* glsl_h_code, const std::string& macro_sel = "");
+	// Same as Compile but only looks in the program binary cache, returns 0 on a miss
+	GLuint LoadCached(const std::string& entry, GLenum type, const char* glsl_h_code, const std::string& macro_sel = "");
 	GLuint LinkPipeline(const string& pretty_print, GLuint vs, GLuint gs, GLuint ps);
 
 	// Same as above but for not separated build
@@ -54,4 +67,6 @@ class GSShaderOGL {
 	GLuint LinkProgram(GLuint vs, GLuint gs, GLuint ps);
 
 	int DumpAsm(const std::string& file, GLuint p);
+
+	const std::string& GetCacheDir() const { return m_cache_dir; }
 };
@@ -202,6 +202,8 @@ void GSState::SetFrameSkip(int skip)
 
 		m_fpGIFPackedRegHandlersC[GIF_REG_STQRGBAXYZF2] = &GSState::GIFPackedRegHandlerNOP;
 		m_fpGIFPackedRegHandlersC[GIF_REG_STQRGBAXYZ2] = &GSState::GIFPackedRegHandlerNOP;
+
+		m_fpGIFPackedRegHandlerV = &GSState::GIFPackedRegHandlerVertex<GS_INVALID, false>;
 	}
 	else
 	{
@@ -281,6 +283,7 @@ void GSState::ResetHandlers()
 		m_fpGIFRegHandlerXYZ[P][3] = &GSState::GIFRegHandlerXYZ2<P, 1>; \
 		m_fpGIFPackedRegHandlerSTQRGBAXYZF2[P] = &GSState::GIFPackedRegHandlerSTQRGBAXYZF2<P>; \
 		m_fpGIFPackedRegHandlerSTQRGBAXYZ2[P] = &GSState::GIFPackedRegHandlerSTQRGBAXYZ2<P>; \
+		m_fpGIFPackedRegHandlerVertex[P] = &GSState::GIFPackedRegHandlerVertex<P, true>; \
 
 	SetHandlerXYZ(GS_POINTLIST);
 	SetHandlerXYZ(GS_LINELIST);
@@ -703,6 +706,44 @@ void GSState::GIFPackedRegHandlerNOP(const GIFPackedReg* RESTRICT r, uint32 size
 {
 }
 
+template<uint32 prim, bool kick>
+void GSState::GIFPackedRegHandlerVertex(const GIFPackedReg* RESTRICT r, uint32 size, const GIFPath& path)
+{
+	// any mix of vertex registers (see GIFPath::VERTEX_REGS), PRIM cannot change inside the loop,
+	// so the per register handlers are called directly and can be inlined, no indirect call per register
+
+	ASSERT(size > 0 && size % path.nreg == 0);
+
+	const GIFPackedReg* RESTRICT r_end = r + size;
+
+	const uint32 nreg = path.nreg;
+
+	alignas(16) uint8 regs[16];
+
+	GSVector4i::store<true>(regs, path.regs);
+
+	do
+	{
+		for(uint32 i = 0; i < nreg; i++, r++)
+		{
+			switch(regs[i])
+			{
+			case GIF_REG_RGBA: GIFPackedRegHandlerRGBA(r); break;
+			case GIF_REG_STQ: GIFPackedRegHandlerSTQ(r); break;
+			case GIF_REG_UV: if(!UserHacks_WildHack) GIFPackedRegHandlerUV(r); else GIFPackedRegHandlerUV_Hack(r); break;
+			case GIF_REG_XYZF2: if(kick) GIFPackedRegHandlerXYZF2<prim, 0>(r); break;
+			case GIF_REG_XYZ2: if(kick) GIFPackedRegHandlerXYZ2<prim, 0>(r); break;
+			case GIF_REG_FOG: GIFPackedRegHandlerFOG(r); break;
+			case GIF_REG_XYZF3: if(kick) GIFPackedRegHandlerXYZF2<prim, 1>(r); break;
+			case GIF_REG_XYZ3: if(kick) GIFPackedRegHandlerXYZ2<prim, 1>(r); break;
+			case GIF_REG_NOP: break;
+			default: __assume(0);
+			}
+		}
+	}
+	while(r < r_end);
+}
+
 // GIFRegHandler*
 
 void GSState::GIFRegHandlerNull(const GIFReg* RESTRICT r)
@@ -710,6 +751,26 @@ void GSState::GIFRegHandlerNull(const GIFReg* RESTRICT r)
 	// ASSERT(0);
 }
 
+// For registers that only matter when a PRIM bit is set (TME, FGE, ABE/AA1). Those bits can
+// only change through PRIM/PRMODE/PRMODECONT, which flush first, so when the queued primitives
+// don't use the register its new value can't affect them and they keep batching with the next ones.
+__forceinline void GSState::FlushIfUsed(bool used)
+{
+	if(used)
+	{
+		Flush();
+	}
+	else
+	{
+		FlushWrite();
+
+		if(m_index.tail > 0)
+		{
+			m_perfmon.Put(GSPerfMon::DrawMerged, 1);
+		}
+	}
+}
+
 __forceinline void GSState::ApplyPRIM(uint32 prim)
 {
 	// ASSERT(r->PRIM.PRIM < 7);
@@ -985,7 +1046,7 @@ template<int i> void GSState::GIFRegHandlerCLAMP(const GIFReg* RESTRICT r)
 {
 	if(PRIM->CTXT == i && r->CLAMP != m_env.CTXT[i].CLAMP)
 	{
-		Flush();
+		FlushIfUsed(PRIM->TME);
 	}
 
 	m_env.CTXT[i].CLAMP = (GSVector4i)r->CLAMP;
@@ -1004,7 +1065,7 @@ template<int i> void GSState::GIFRegHandlerTEX1(const GIFReg* RESTRICT r)
 {
 	if(PRIM->CTXT == i && r->TEX1 != m_env.CTXT[i].TEX1)
 	{
-		Flush();
+		FlushIfUsed(PRIM->TME);
 	}
 
 	m_env.CTXT[i].TEX1 = (GSVector4i)r->TEX1;
@@ -1103,7 +1164,7 @@ template<int i> void GSState::GIFRegHandlerMIPTBP1(const GIFReg* RESTRICT r)
 {
 	if(PRIM->CTXT == i && r->MIPTBP1 != m_env.CTXT[i].MIPTBP1)
 	{
-		Flush();
+		FlushIfUsed(PRIM->TME);
 	}
 
 	m_env.CTXT[i].MIPTBP1 = (GSVector4i)r->MIPTBP1;
@@ -1113,7 +1174,7 @@ template<int i> void GSState::GIFRegHandlerMIPTBP2(const GIFReg* RESTRICT r)
 {
 	if(PRIM->CTXT == i && r->MIPTBP2 != m_env.CTXT[i].MIPTBP2)
 	{
-		Flush();
+		FlushIfUsed(PRIM->TME);
 	}
 
 	m_env.CTXT[i].MIPTBP2 = (GSVector4i)r->MIPTBP2;
@@ -1123,7 +1184,7 @@ void GSState::GIFRegHandlerTEXA(const GIFReg* RESTRICT r)
 {
 	if(r->TEXA != m_env.TEXA)
 	{
-		Flush();
+		FlushIfUsed(PRIM->TME);
 	}
 
 	m_env.TEXA = (GSVector4i)r->TEXA;
@@ -1133,7 +1194,7 @@ void GSState::GIFRegHandlerFOGCOL(const GIFReg* RESTRICT r)
 {
 	if(r->FOGCOL != m_env.FOGCOL)
 	{
-		Flush();
+		FlushIfUsed(PRIM->FGE);
 	}
 
 	m_env.FOGCOL = (GSVector4i)r->FOGCOL;
@@ -1167,7 +1228,7 @@ template<int i> void GSState::GIFRegHandlerALPHA(const GIFReg* RESTRICT r)
 
 	if(PRIM->CTXT == i && r->ALPHA != m_env.CTXT[i].ALPHA)
 	{
-		Flush();
+		FlushIfUsed(PRIM->ABE || PRIM->AA1);
 	}
 
 	m_env.CTXT[i].ALPHA = (GSVector4i)r->ALPHA;
@@ -2040,6 +2101,14 @@ template<int index> void GSState::Transfer(const uint8* mem, uint32 size)
 
 						break;
 
+					case GIFPath::TYPE_VERTEX: // other vertex formats, NOP padded, UV, FOG, several vertices per loop
+
+						(this->*m_fpGIFPackedRegHandlerV)((GIFPackedReg*)mem, total, path);
+
+						mem += total * sizeof(GIFPackedReg);
+
+						break;
+
 					default:
 
 						__assume(0);
@@ -2423,6 +2492,8 @@ void GSState::UpdateVertexKick()
 
 	m_fpGIFPackedRegHandlersC[GIF_REG_STQRGBAXYZF2] = m_fpGIFPackedRegHandlerSTQRGBAXYZF2[prim];
 	m_fpGIFPackedRegHandlersC[GIF_REG_STQRGBAXYZ2] = m_fpGIFPackedRegHandlerSTQRGBAXYZ2[prim];
+
+	m_fpGIFPackedRegHandlerV = m_fpGIFPackedRegHandlerVertex[prim];
 }
 
 void GSState::GrowVertexBuffer()
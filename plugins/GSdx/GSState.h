@@ -83,8 +83,16 @@ class GSState : public GSAlignedClass<32>
 	template<uint32 prim> void GIFPackedRegHandlerSTQRGBAXYZ2(const GIFPackedReg* RESTRICT r, uint32 size);
 	void GIFPackedRegHandlerNOP(const GIFPackedReg* RESTRICT r, uint32 size);
 
+	typedef void (GSState::*GIFPackedRegHandlerV)(const GIFPackedReg* RESTRICT r, uint32 size, const GIFPath& path);
+
+	GIFPackedRegHandlerV m_fpGIFPackedRegHandlerV;
+	GIFPackedRegHandlerV m_fpGIFPackedRegHandlerVertex[8];
+
+	template<uint32 prim, bool kick> void GIFPackedRegHandlerVertex(const GIFPackedReg* RESTRICT r, uint32 size, const GIFPath& path);
+
 	template<int i> void ApplyTEX0(GIFRegTEX0& TEX0);
 	void ApplyPRIM(uint32 prim);
+	void FlushIfUsed(bool used);
 
 	void GIFRegHandlerNull(const GIFReg* RESTRICT r);
 	void GIFRegHandlerPRIM(const GIFReg* RESTRICT r);
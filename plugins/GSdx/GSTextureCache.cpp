@@ -263,7 +263,7 @@ GSTextureCache::Source* GSTextureCache::LookupSource(const GIFRegTEX0& TEX0, con
 						// Gregory: to avoid a massive slow down for nothing, let's only enable
 						// this code when CRC is below the FULL level
 						if (m_crc_hack_level < 3)
-							Read(t, t->m_valid);
+							ReadBack(t, t->m_valid);
 						else
 							dst = t;
 					} else {
@@ -332,10 +332,14 @@ GSTextureCache::Source* GSTextureCache::LookupSource(const GIFRegTEX0& TEX0, con
 #endif
 		src = CreateSource(TEX0, TEXA, dst, half_right);
 
+		m_renderer->m_perfmon.Put(GSPerfMon::TextureCacheMiss, 1);
+
 	} else {
 		GL_CACHE("TC: src hit: %d (0x%x, F:0x%x)",
 					src->m_texture ? src->m_texture->GetID() : 0,
 					TEX0.TBP0, TEX0.PSM);
+
+		m_renderer->m_perfmon.Put(GSPerfMon::TextureCacheHit, 1);
 	}
 
 	if (src->m_palette)
@@ -860,7 +864,7 @@ void GSTextureCache::InvalidateLocalMem(GSOffset* off, const GSVector4i& r)
 			for(auto t : m_dst[DepthStencil]) {
 				if(GSUtil::HasSharedBits(bp, psm, t->m_TEX0.TBP0, t->m_TEX0.PSM)) {
 					// Read the full depth buffer for easy testing
-					Read(t, t->m_valid);
+					ReadBack(t, t->m_valid);
 				}
 			}
 		}
@@ -892,12 +896,12 @@ void GSTextureCache::InvalidateLocalMem(GSOffset* off, const GSVector4i& r)
 				// note: r.rintersect breaks Wizardry and Chaos Legion
 				// Read(t, t->m_valid) works in all tested games but is very slow in GUST titles ><
 				if (GSTextureCache::m_disable_partial_invalidation) {
-					Read(t, r.rintersect(t->m_valid));
+					ReadBack(t, r.rintersect(t->m_valid));
 				} else {
 					if (r.x == 0 && r.y == 0) // Full screen read?
-						Read(t, t->m_valid);
+						ReadBack(t, t->m_valid);
 					else // Block level read?
-						Read(t, r.rintersect(t->m_valid));
+						ReadBack(t, r.rintersect(t->m_valid));
 				}
 			}
 		} else {
@@ -999,6 +1003,29 @@ void GSTextureCache::InvalidateVideoMemSubTarget(GSTextureCache::Target* rt)
 	}
 }
 
+void GSTextureCache::ReadBack(Target* t, const GSVector4i& r)
+{
+	// Several transfers often hit the same target between two draws (Move done line by line,
+	// full target read for each block). The local memory already holds that data, so skip
+	// the GPU readback, which would stall the whole pipeline.
+	if (t->m_readback_TEX0 == t->m_TEX0.u64 && r.rintersect(t->m_readback).eq(r)) {
+		m_renderer->m_perfmon.Put(GSPerfMon::ReadbackAvoided, 1);
+		return;
+	}
+
+	// Read may skip the target (dirty, or a format the renderer can't read back), then there
+	// is nothing to remember
+	if (!Read(t, r))
+		return;
+
+	m_renderer->m_perfmon.Put(GSPerfMon::Readback, 1);
+
+	if (t->m_readback_TEX0 != t->m_TEX0.u64 || t->m_readback.rempty() || r.rintersect(t->m_readback).eq(t->m_readback)) {
+		t->m_readback = r;
+		t->m_readback_TEX0 = t->m_TEX0.u64;
+	}
+}
+
 void GSTextureCache::IncAge()
 {
 	int maxage = m_src.m_used ? 3 : 30;
@@ -1729,6 +1756,8 @@ GSTextureCache::Target::Target(GSRenderer* r, const GIFRegTEX0& TEX0, uint8* tem
 	m_dirty_alpha = GSLocalMemory::m_psm[TEX0.PSM].trbpp != 24;
 
 	m_valid = GSVector4i::zero();
+	m_readback = GSVector4i::zero();
+	m_readback_TEX0 = 0;
 }
 
 void GSTextureCache::Target::Update()
@@ -89,6 +89,8 @@ public:
 		bool m_depth_supported;
 		bool m_dirty_alpha;
 		uint32 m_end_block; // Hint of the target area
+		GSVector4i m_readback; // Area already written back to the local memory and not drawn since
+		uint64 m_readback_TEX0; // m_TEX0 at the time of the readback (the local memory layout)
 
 	public:
 		Target(GSRenderer* r, const GIFRegTEX0& TEX0, uint8* temp, bool depth_supported);
@@ -143,8 +145,9 @@ protected:
 public:
 	GSTextureCache(GSRenderer* r);
 	virtual ~GSTextureCache();
-	virtual void Read(Target* t, const GSVector4i& r) = 0;
+	virtual bool Read(Target* t, const GSVector4i& r) = 0; // false if nothing was read back
 	virtual void Read(Source* t, const GSVector4i& r) = 0;
+	void ReadBack(Target* t, const GSVector4i& r);
 	void RemoveAll();
 	void RemovePartial();
 
@@ -29,13 +29,13 @@ GSTextureCache11::GSTextureCache11(GSRenderer* r)
 {
 }
 
-void GSTextureCache11::Read(Target* t, const GSVector4i& r)
+bool GSTextureCache11::Read(Target* t, const GSVector4i& r)
 {
 	if(t->m_type != RenderTarget)
 	{
 		// TODO
 
-		return;
+		return false;
 	}
 
 	const GIFRegTEX0& TEX0 = t->m_TEX0;
@@ -47,12 +47,12 @@ void GSTextureCache11::Read(Target* t, const GSVector4i& r)
 	{
 		//ASSERT(0);
 
-		return;
+		return false;
 	}
 
 	if (!t->m_dirty.empty() || (r.width() == 0 && r.height() == 0))
 	{
-		return;
+		return false;
 	}
 
 	// printf("GSRenderTarget::Read %d,%d - %d,%d (%08x)\n", r.left, r.top, r.right, r.bottom, TEX0.TBP0);
@@ -64,6 +64,8 @@ void GSTextureCache11::Read(Target* t, const GSVector4i& r)
 
 	DXGI_FORMAT format = TEX0.PSM == PSM_PSMCT16 || TEX0.PSM == PSM_PSMCT16S ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R8G8B8A8_UNORM;
 
+	bool read = false;
+
 	if(GSTexture* offscreen = m_renderer->m_dev->CopyOffscreen(t->m_texture, src, w, h, format))
 	{
 		GSTexture::GSMap m;
@@ -91,10 +93,14 @@ void GSTextureCache11::Read(Target* t, const GSVector4i& r)
 			}
 
 			offscreen->Unmap();
+
+			read = true;
 		}
 
 		m_renderer->m_dev->Recycle(offscreen);
 	}
+
+	return read;
 }
 
 void GSTextureCache11::Read(Source* t, const GSVector4i& r)
@@ -29,7 +29,7 @@ class GSTextureCache11 : public GSTextureCache
 protected:
 	int Get8bitFormat() {return DXGI_FORMAT_A8_UNORM;}
 
-	void Read(Target* t, const GSVector4i& r);
+	bool Read(Target* t, const GSVector4i& r);
 	void Read(Source* t, const GSVector4i& r);
 
 	virtual bool CanConvertDepth() { return false; }
@@ -29,13 +29,13 @@ GSTextureCache9::GSTextureCache9(GSRenderer* r)
 {
 }
 
-void GSTextureCache9::Read(Target* t, const GSVector4i& r)
+bool GSTextureCache9::Read(Target* t, const GSVector4i& r)
 {
 	if(t->m_type != RenderTarget)
 	{
 		// TODO
 
-		return;
+		return false;
 	}
 
 	const GIFRegTEX0& TEX0 = t->m_TEX0;
@@ -47,12 +47,12 @@ void GSTextureCache9::Read(Target* t, const GSVector4i& r)
 	{
 		//ASSERT(0);
 
-		return;
+		return false;
 	}
 
 	if (!t->m_dirty.empty() || (r.width() == 0 && r.height() == 0))
 	{
-		return;
+		return false;
 	}
 
 	// printf("GSRenderTarget::Read %d,%d - %d,%d (%08x)\n", r.left, r.top, r.right, r.bottom, TEX0.TBP0);
@@ -62,6 +62,8 @@ void GSTextureCache9::Read(Target* t, const GSVector4i& r)
 
 	GSVector4 src = GSVector4(r) * GSVector4(t->m_texture->GetScale()).xyxy() / GSVector4(t->m_texture->GetSize()).xyxy();
 
+	bool read = false;
+
 	if(GSTexture* offscreen = m_renderer->m_dev->CopyOffscreen(t->m_texture, src, w, h))
 	{
 		GSTexture::GSMap m;
@@ -89,10 +91,14 @@ void GSTextureCache9::Read(Target* t, const GSVector4i& r)
 			}
 
 			offscreen->Unmap();
+
+			read = true;
 		}
 
 		m_renderer->m_dev->Recycle(offscreen);
 	}
+
+	return read;
 }
 
 void GSTextureCache9::Read(Source* t, const GSVector4i& r)
@@ -29,7 +29,7 @@ class GSTextureCache9 : public GSTextureCache
 protected:
 	int Get8bitFormat() {return D3DFMT_A8;}
 
-	void Read(Target* t, const GSVector4i& r);
+	bool Read(Target* t, const GSVector4i& r);
 	void Read(Source* t, const GSVector4i& r);
 
 	virtual bool CanConvertDepth() { return false; }
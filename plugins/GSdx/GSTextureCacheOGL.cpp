@@ -28,10 +28,10 @@ GSTextureCacheOGL::GSTextureCacheOGL(GSRenderer* r)
 {
 }
 
-void GSTextureCacheOGL::Read(Target* t, const GSVector4i& r)
+bool GSTextureCacheOGL::Read(Target* t, const GSVector4i& r)
 {
 	if (!t->m_dirty.empty() || (r.width() == 0 && r.height() == 0))
-		return;
+		return false;
 
 	const GIFRegTEX0& TEX0 = t->m_TEX0;
 
@@ -68,7 +68,7 @@ void GSTextureCacheOGL::Read(Target* t, const GSVector4i& r)
 			break;
 
 		default:
-			return;
+			return false;
 	}
 
 
@@ -80,6 +80,8 @@ void GSTextureCacheOGL::Read(Target* t, const GSVector4i& r)
 
 	GSVector4 src = GSVector4(r) * GSVector4(t->m_texture->GetScale()).xyxy() / GSVector4(t->m_texture->GetSize()).xyxy();
 
+	bool read = false;
+
 	if(GSTexture* offscreen = m_renderer->m_dev->CopyOffscreen(t->m_texture, src, r.width(), r.height(), fmt, ps_shader))
 	{
 		GSTexture::GSMap m;
@@ -120,11 +122,15 @@ void GSTextureCacheOGL::Read(Target* t, const GSVector4i& r)
 			}
 
 			offscreen->Unmap();
+
+			read = true;
 		}
 
 		// FIXME invalidate data
 		m_renderer->m_dev->Recycle(offscreen);
 	}
+
+	return read;
 }
 
 void GSTextureCacheOGL::Read(Source* t, const GSVector4i& r)
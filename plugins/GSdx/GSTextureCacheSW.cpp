@@ -65,11 +65,15 @@ GSTextureCacheSW::Texture* GSTextureCacheSW::Lookup(const GIFRegTEX0& TEX0, cons
 
 		t->m_age = 0;
 
+		m_state->m_perfmon.Put(GSPerfMon::TextureCacheHit, 1);
+
 		break;
 	}
 
 	if(t == NULL)
 	{
+		m_state->m_perfmon.Put(GSPerfMon::TextureCacheMiss, 1);
+
 		t = new Texture(m_state, tw0, TEX0, TEXA);
 
 		m_textures.insert(t);
@@ -212,6 +216,30 @@ GSTextureCacheSW::Texture::~Texture()
 	}
 }
 
+// minimum number of blocks handed to one GSLocalMemory worker
+
+#define READ_TEXTURE_MT_BLOCKS 128
+
+class GSReadTextureBlockJob : public GSLocalMemory::Job
+{
+public:
+	const GSLocalMemory* mem;
+	GSLocalMemory::readTextureBlock rtxb;
+	const GSVector2i* blocks;
+	int count;
+	uint8* buff;
+	int pitch;
+	GIFRegTEXA TEXA;
+
+	void Run()
+	{
+		for(int i = 0; i < count; i++)
+		{
+			(mem->*rtxb)(blocks[i].x, &buff[blocks[i].y], pitch, TEXA);
+		}
+	}
+};
+
 bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 {
 	if(m_complete)
@@ -270,6 +298,12 @@ bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 
 	shift += 3;
 
+	// large updates only mark the blocks valid here, they are decoded together on the workers at the end
+
+	vector<GSVector2i> pending;
+
+	bool mt = mem.GetThreads() > 0 && (r.width() / bs.x) * (r.height() / bs.y) >= READ_TEXTURE_MT_BLOCKS * 2;
+
 	if(m_repeating)
 	{
 		for(int y = r.top; y < r.bottom; y += bs.y, dst += block_pitch)
@@ -289,7 +323,14 @@ bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 					{
 						m_valid[row] |= col;
 
-						(mem.*rtxbP)(block, &dst[x << shift], pitch, m_TEXA);
+						if(mt)
+						{
+							pending.push_back(GSVector2i(block, (int)(&dst[x << shift] - (uint8*)m_buff)));
+						}
+						else
+						{
+							(mem.*rtxbP)(block, &dst[x << shift], pitch, m_TEXA);
+						}
 
 						blocks++;
 					}
@@ -316,7 +357,14 @@ bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 					{
 						m_valid[row] |= col;
 
-						(mem.*rtxbP)(block, &dst[x << shift], pitch, m_TEXA);
+						if(mt)
+						{
+							pending.push_back(GSVector2i(block, (int)(&dst[x << shift] - (uint8*)m_buff)));
+						}
+						else
+						{
+							(mem.*rtxbP)(block, &dst[x << shift], pitch, m_TEXA);
+						}
 
 						blocks++;
 					}
@@ -325,6 +373,35 @@ bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 		}
 	}
 
+	if(!pending.empty())
+	{
+		int count = (int)pending.size();
+		int bands = std::max<int>(std::min<int>(mem.GetThreads() + 1, count / READ_TEXTURE_MT_BLOCKS), 1);
+		int step = (count + bands - 1) / bands;
+
+		vector<GSReadTextureBlockJob> jobs(bands);
+		vector<GSLocalMemory::Job*> ptrs(bands);
+
+		int n = 0;
+
+		for(int i = 0; i < count; i += step, n++)
+		{
+			GSReadTextureBlockJob& job = jobs[n];
+
+			job.mem = &mem;
+			job.rtxb = rtxbP;
+			job.blocks = &pending[i];
+			job.count = std::min<int>(count - i, step);
+			job.buff = (uint8*)m_buff;
+			job.pitch = pitch;
+			job.TEXA = m_TEXA;
+
+			ptrs[n] = &job;
+		}
+
+		mem.Run(ptrs.data(), n);
+	}
+
 	if(blocks > 0)
 	{
 		m_state->m_perfmon.Put(GSPerfMon::Unswizzle, bs.x * bs.y * blocks << shift);
@@ -29,7 +29,9 @@
 extern uint64 g_real_texture_upload_byte;
 #endif
 
-// FIXME OGL4: investigate, only 1 unpack buffer always bound
+// Single persistent ring shared by every texture upload. The buffer stays bound to
+// GL_PIXEL_UNPACK_BUFFER from Init to Destroy: nothing else in GSdx sources pixels from
+// client memory (glClearTexSubImage data is never read from a buffer object)
 namespace PboPool {
 
 	const  uint32 m_pbo_size = 64*1024*1024;
@@ -41,6 +43,10 @@ namespace PboPool {
 	uint32 m_size;
 	GLsync m_fence[m_pbo_size/m_seg_size];
 
+	// Statistics since the last GetStats
+	uint64 m_upload_byte;
+	uint32 m_fence_wait;
+
 	// Option for buffer storage
 	// XXX: actually does I really need coherent and barrier???
 	// As far as I understand glTexSubImage2D is a client-server transfer so no need to make
@@ -64,7 +70,8 @@ namespace PboPool {
 			m_fence[i] = 0;
 		}
 
-		UnbindPbo();
+		m_upload_byte = 0;
+		m_fence_wait  = 0;
 	}
 
 	char* Map(uint32 size) {
@@ -75,10 +82,7 @@ namespace PboPool {
 			fprintf(stderr, "BUG: PBO too small %d but need %d\n", m_pbo_size, m_size);
 		}
 
-		// Note: texsubimage will access currently bound buffer
-		// Pbo ready let's get a pointer
-		BindPbo();
-
+		// Note: texsubimage will access currently bound buffer (always the PBO)
 		Sync();
 
 		map = m_map + m_offset;
@@ -88,6 +92,8 @@ namespace PboPool {
 
 	void Unmap() {
 		glFlushMappedBufferRange(GL_PIXEL_UNPACK_BUFFER, m_offset, m_size);
+
+		m_upload_byte += m_size;
 	}
 
 	uptr Offset() {
@@ -133,6 +139,7 @@ namespace PboPool {
 				GLenum status = glClientWaitSync(m_fence[segment_next], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
 				// Potentially it doesn't work on AMD driver which might always return GL_CONDITION_SATISFIED
 				if (status != GL_ALREADY_SIGNALED) {
+					m_fence_wait++;
 					GL_PERF("GL_PIXEL_UNPACK_BUFFER: Sync Sync (%x)! Buffer too small ?", status);
 				}
 
@@ -150,6 +157,14 @@ namespace PboPool {
 		// Note: keep offset aligned for SSE/AVX
 		m_offset += (m_size + 63) & ~0x3F;
 	}
+
+	void GetStats(uint64& upload_byte, uint32& fence_wait) {
+		upload_byte = m_upload_byte;
+		fence_wait  = m_fence_wait;
+
+		m_upload_byte = 0;
+		m_fence_wait  = 0;
+	}
 }
 
 GSTextureOGL::GSTextureOGL(int type, int w, int h, int format, GLuint fbo_read)
@@ -333,21 +348,21 @@ bool GSTextureOGL::Update(const GSVector4i& r, const void* data, int pitch)
 	char* src = (char*)data;
 	char* map = PboPool::Map(map_size);
 
-	// PERF: slow path of the texture upload. Dunno if we could do better maybe check if TC can keep row_byte == pitch
-	// Note: row_byte != pitch
-	for (int h = 0; h < r.height(); h++) {
-		memcpy(map, src, row_byte);
-		map += row_byte;
-		src += pitch;
+	if (row_byte == (uint32)pitch) {
+		memcpy(map, src, map_size);
+	} else {
+		// PERF: slow path of the texture upload. Dunno if we could do better maybe check if TC can keep row_byte == pitch
+		for (int h = 0; h < r.height(); h++) {
+			memcpy(map, src, row_byte);
+			map += row_byte;
+			src += pitch;
+		}
 	}
 
 	PboPool::Unmap();
 
 	glTextureSubImage2D(m_texture_id, GL_TEX_LEVEL_0, r.x, r.y, r.width(), r.height(), m_int_format, m_int_type, (const void*)PboPool::Offset());
 
-	// FIXME OGL4: investigate, only 1 unpack buffer always bound
-	PboPool::UnbindPbo();
-
 	PboPool::EndTransfer();
 #endif
 
@@ -421,9 +436,6 @@ void GSTextureOGL::Unmap()
 
 		glTextureSubImage2D(m_texture_id, GL_TEX_LEVEL_0, m_r_x, m_r_y, m_r_w, m_r_h, m_int_format, m_int_type, (const void*)PboPool::Offset());
 
-		// FIXME OGL4: investigate, only 1 unpack buffer always bound
-		PboPool::UnbindPbo();
-
 		PboPool::EndTransfer();
 
 		GL_POP(); // PUSH is in Map
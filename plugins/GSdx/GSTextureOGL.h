@@ -35,6 +35,7 @@ namespace PboPool {
 
 	void Init();
 	void Destroy();
+	void GetStats(uint64& upload_byte, uint32& fence_wait);
 }
 
 class GSTextureOGL final : public GSTexture
@@ -419,6 +419,12 @@ GSRendererType GSUtil::GetBestRenderer()
 	return GSRendererType::DX9_HW;
 }
 
+void GSmkdir(const char* dir)
+{
+	if (!CreateDirectoryA(dir, NULL) && GetLastError() != ERROR_ALREADY_EXISTS)
+		fprintf(stderr, "Failed to create directory: %s\n", dir);
+}
+
 #else
 
 void GSmkdir(const char* dir)
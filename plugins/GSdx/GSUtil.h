@@ -66,6 +66,4 @@ public:
 #endif
 };
 
-#if defined(__unix__)
 void GSmkdir(const char* dir);
-#endif
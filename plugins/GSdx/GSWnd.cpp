@@ -107,6 +107,7 @@ void GSWndGL::PopulateGlFunction()
 	GL_EXT_LOAD(glValidateProgramPipeline);
 	GL_EXT_LOAD(glUseProgramStages);
 	GL_EXT_LOAD_OPT(glGetProgramBinary);
+	GL_EXT_LOAD_OPT(glProgramBinary);
 	GL_EXT_LOAD_OPT(glViewportIndexedf);
 	GL_EXT_LOAD_OPT(glViewportIndexedfv);
 	GL_EXT_LOAD_OPT(glScissorIndexed);
@@ -294,6 +294,8 @@ GSdxApp::GSdxApp()
 	m_default_configuration["override_GL_ARB_viewport_array"]             = "-1";
 	m_default_configuration["override_GL_EXT_texture_filter_anisotropic"] = "-1";
 	m_default_configuration["paltex"]                                     = "0";
+	m_default_configuration["perfmon_json"]                               = "0";
+	m_default_configuration["perfmon_log"]                                = "";
 	m_default_configuration["png_compression_level"]                      = to_string(Z_BEST_SPEED);
 	m_default_configuration["preload_frame_with_gs_data"]                 = "0";
 	m_default_configuration["Renderer"]                                   = to_string(static_cast<int>(GSRendererType::Default));
@@ -312,6 +314,8 @@ GSdxApp::GSdxApp()
 	m_default_configuration["shaderfx"]                                   = "0";
 	m_default_configuration["shaderfx_conf"]                              = "shaders/GSdx_FX_Settings.ini";
 	m_default_configuration["shaderfx_glsl"]                              = "shaders/GSdx.fx";
+	m_default_configuration["shader_cache"]                               = "1";
+	m_default_configuration["shader_cache_dir"]                           = "shader_cache";
 	m_default_configuration["TVShader"]                                   = "0";
 	m_default_configuration["upscale_multiplier"]                         = "1";
 	m_default_configuration["UserHacks"]                                  = "0";
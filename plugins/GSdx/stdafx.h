@@ -102,6 +102,7 @@ typedef int64 sint64;
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
+#include <chrono>
 
 using namespace std;
 
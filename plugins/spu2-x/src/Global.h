@@ -38,6 +38,7 @@ namespace soundtouch
 #include <cmath>
 #include <ctime>
 #include <stdexcept>
+#include <atomic>
 
 #include "Utilities/Dependencies.h"
 #include "Pcsx2Defs.h"
@@ -22,6 +22,13 @@
 // disable the optimisation until we can tie it to the game database.
 #define NEVER_SKIP_VOICES 1
 
+// When set, every sample is mixed by both the scalar reference code and the SSE2 lanes, from
+// the same voice state, and the results are compared (see s2r_verify).  The scalar result is
+// the one that is output.
+bool VoiceMixVerify = false;
+u64 VoiceMixVerifySamples = 0;
+u64 VoiceMixVerifyMismatches = 0;
+
 void ADMAOutLogWrite(void *lpData, u32 ulSize);
 
 static const s32 tbl_XA_Factor[16][2] =
@@ -139,6 +146,11 @@ PcmCacheEntry *pcm_cache_data = NULL;
 int g_counter_cache_hits = 0;
 int g_counter_cache_misses = 0;
 int g_counter_cache_ignores = 0;
+int g_counter_cache_predictor_misses = 0;
+
+// Blocks entered with a predictor state other than the one they were cached with are
+// decoded here, so that they don't clobber the cache line another voice may be playing.
+static s16 pcm_voice_scratch[2][V_Core::NumVoices][pcm_DecodedSamplesPerBlock];
 
 // LOOP/END sets the ENDX bit and sets NAX to LSA, and the voice is muted if LOOP is not set
 // LOOP seems to only have any effect on the block with LOOP/END set, where it prevents muting the voice
@@ -198,7 +210,7 @@ static __forceinline s32 GetNextDataBuffered( V_Core& thiscore, uint voiceidx )
 		PcmCacheEntry& cacheLine = pcm_cache_data[cacheIdx];
 		vc.SBuffer = cacheLine.Sampledata;
 
-		if( cacheLine.Validated )
+		if( cacheLine.Validated && cacheLine.Prev1 == vc.Prev1 && cacheLine.Prev2 == vc.Prev2 )
 		{
 			// Cached block!  Read from the cache directly.
 			// Make sure to propagate the prev1/prev2 ADPCM:
@@ -211,11 +223,26 @@ static __forceinline s32 GetNextDataBuffered( V_Core& thiscore, uint voiceidx )
 			if( IsDevBuild )
 				g_counter_cache_hits++;
 		}
+		else if( cacheLine.Validated )
+		{
+			// Valid block, but decoded from a different predictor state (typically a loop
+			// point reached from somewhere else).  Decode privately and keep the line.
+			vc.SBuffer = pcm_voice_scratch[thiscore.Index][voiceidx];
+
+			if( IsDevBuild )
+				g_counter_cache_predictor_misses++;
+
+			XA_decode_block( vc.SBuffer, memptr, vc.Prev1, vc.Prev2 );
+		}
 		else
 		{
 			// Only flag the cache if it's a non-dynamic memory range.
 			if( vc.NextA >= SPU2_DYN_MEMLINE )
+			{
 				cacheLine.Validated = true;
+				cacheLine.Prev1 = vc.Prev1;
+				cacheLine.Prev2 = vc.Prev2;
+			}
 
 			if( IsDevBuild )
 			{
@@ -475,11 +502,12 @@ static s32 CubicInterpolate(
 	return(val + (y1<<1));
 }
 
-// Returns a 16 bit result in Value.
-// Uses standard template-style optimization techniques to statically generate five different
-// versions of this function (one for each type of interpolation).
+// Advances the voice's sample pointer, pulling decoded samples into the PV history.
+// Uses standard template-style optimization techniques to statically generate a
+// version of this function for each type of interpolation (only cubic-style
+// interpolators need the PV3/PV4 history).
 template< int InterpType >
-static __forceinline s32 GetVoiceValues( V_Core& thiscore, uint voiceidx )
+static __forceinline void FetchVoiceSamples( V_Core& thiscore, uint voiceidx )
 {
 	V_Voice& vc( thiscore.Voices[voiceidx] );
 
@@ -494,22 +522,6 @@ static __forceinline s32 GetVoiceValues( V_Core& thiscore, uint voiceidx )
 		vc.PV1 = GetNextDataBuffered( thiscore, voiceidx );
 		vc.SP -= 4096;
 	}
-
-	const s32 mu = vc.SP + 4096;
-
-	switch( InterpType )
-	{
-		case 0: return vc.PV1<<1;
-		case 1: return (vc.PV1<<1) - (( (vc.PV2 - vc.PV1) * vc.SP)>>11);
-
-		case 2: return CubicInterpolate				(vc.PV4, vc.PV3, vc.PV2, vc.PV1, mu);
-		case 3: return HermiteInterpolate<16384>	(vc.PV4, vc.PV3, vc.PV2, vc.PV1, mu);
-		case 4: return CatmullRomInterpolate		(vc.PV4, vc.PV3, vc.PV2, vc.PV1, mu);
-
-		jNO_DEFAULT;
-	}
-
-	return 0;		// technically unreachable!
 }
 
 // Noise values need to be mixed without going through interpolation, since it
@@ -560,7 +572,33 @@ static __forceinline void spu2M_WriteFast( u32 addr, s16 value )
 }
 
 
-static __forceinline StereoOut32 MixVoice( uint coreidx, uint voiceidx )
+// Per-voice inputs of the arithmetic half of the voice mixer, laid out as structure-of-arrays
+// so that interpolation, envelope, volume and gating can be done four voices at a time.
+// Filled in by UpdateVoice, which does everything that touches voice state (pitch, ADPCM
+// fetch, IRQs, ADSR, modulation).  Voices that aren't sounding get a zero envelope and
+// volume, which zeroes their contribution exactly like the scalar mixer did.
+struct VoiceLanes
+{
+	__aligned16 s32 PV1[V_Core::NumVoices];
+	__aligned16 s32 PV2[V_Core::NumVoices];
+	__aligned16 s32 PV3[V_Core::NumVoices];
+	__aligned16 s32 PV4[V_Core::NumVoices];
+	__aligned16 s32 SP[V_Core::NumVoices];
+
+	__aligned16 s32 Noise[V_Core::NumVoices];		// -1 for noise voices, 0 for ADPCM voices
+	__aligned16 s32 NoiseVal[V_Core::NumVoices];
+
+	__aligned16 s32 Envelope[V_Core::NumVoices];
+	__aligned16 s32 VolL[V_Core::NumVoices];
+	__aligned16 s32 VolR[V_Core::NumVoices];
+
+	__aligned16 s32 DryL[V_Core::NumVoices];
+	__aligned16 s32 DryR[V_Core::NumVoices];
+	__aligned16 s32 WetL[V_Core::NumVoices];
+	__aligned16 s32 WetR[V_Core::NumVoices];
+};
+
+static __forceinline void UpdateVoice( VoiceLanes& lanes, uint coreidx, uint voiceidx )
 {
 	V_Core& thiscore( Cores[coreidx] );
 	V_Voice& vc( thiscore.Voices[voiceidx] );
@@ -583,10 +621,10 @@ static __forceinline StereoOut32 MixVoice( uint coreidx, uint voiceidx )
 	{
 		UpdatePitch( coreidx, voiceidx );
 
-		s32 Value = 0;
+		lanes.Noise[voiceidx] = vc.Noise ? -1 : 0;
 
 		if( vc.Noise )
-			Value = GetNoiseValues( thiscore, voiceidx );
+			lanes.NoiseVal[voiceidx] = GetNoiseValues( thiscore, voiceidx );
 		else
 		{
 			// Optimization : Forceinline'd Templated Dispatch Table.  Any halfwit compiler will
@@ -594,26 +632,25 @@ static __forceinline StereoOut32 MixVoice( uint coreidx, uint voiceidx )
 
 			switch( Interpolation )
 			{
-				case 0: Value = GetVoiceValues<0>( thiscore, voiceidx ); break;
-				case 1: Value = GetVoiceValues<1>( thiscore, voiceidx ); break;
-				case 2: Value = GetVoiceValues<2>( thiscore, voiceidx ); break;
-				case 3: Value = GetVoiceValues<3>( thiscore, voiceidx ); break;
-				case 4: Value = GetVoiceValues<4>( thiscore, voiceidx ); break;
+				case 0: FetchVoiceSamples<0>( thiscore, voiceidx ); break;
+				case 1: FetchVoiceSamples<1>( thiscore, voiceidx ); break;
+				case 2: FetchVoiceSamples<2>( thiscore, voiceidx ); break;
+				case 3: FetchVoiceSamples<3>( thiscore, voiceidx ); break;
+				case 4: FetchVoiceSamples<4>( thiscore, voiceidx ); break;
 
 				jNO_DEFAULT;
 			}
 		}
 
-		// Update and Apply ADSR  (applies to normal and noise sources)
+		// Update ADSR  (applied to normal and noise sources by the mixing stage)
 		//
 		// Note!  It's very important that ADSR stay as accurate as possible.  By the way
 		// it is used, various sound effects can end prematurely if we truncate more than
 		// one or two bits.  Best result comes from no truncation at all, which is why we
-		// use a full 64-bit multiply/result here.
+		// use a full 64-bit multiply/result when applying it.
 
 		CalculateADSR( thiscore, voiceidx );
-		Value	= MulShr32( Value, vc.ADSR.Value );
-		
+
 		// Store Value for eventual modulation later
 		// Pseudonym's Crest calculation idea. Actually calculates a crest, unlike the old code which was just peak.
 		if(vc.PV1 < vc.NextCrest)
@@ -633,8 +670,10 @@ static __forceinline StereoOut32 MixVoice( uint coreidx, uint voiceidx )
 
 		if (voiceidx==1)      spu2M_WriteFast( ( (0==coreidx) ? 0x400 : 0xc00 ) + OutPos, vc.OutX );
 		else if (voiceidx==3) spu2M_WriteFast( ( (0==coreidx) ? 0x600 : 0xe00 ) + OutPos, vc.OutX );
-			
-		return ApplyVolume( StereoOut32( Value, Value ), vc.Volume );
+
+		lanes.Envelope[voiceidx]	= vc.ADSR.Value;
+		lanes.VolL[voiceidx]		= vc.Volume.Left.Value;
+		lanes.VolR[voiceidx]		= vc.Volume.Right.Value;
 	}
 	else
 	{
@@ -655,26 +694,231 @@ static __forceinline StereoOut32 MixVoice( uint coreidx, uint voiceidx )
 		if (voiceidx==1)      spu2M_WriteFast( ( (0==coreidx) ? 0x400 : 0xc00 ) + OutPos, 0 );
 		else if (voiceidx==3) spu2M_WriteFast( ( (0==coreidx) ? 0x600 : 0xe00 ) + OutPos, 0 );
 
-		return StereoOut32( 0, 0 );
+		lanes.Noise[voiceidx]		= 0;
+		lanes.Envelope[voiceidx]	= 0;
+		lanes.VolL[voiceidx]		= 0;
+		lanes.VolR[voiceidx]		= 0;
+	}
+
+	lanes.PV1[voiceidx]	= vc.PV1;
+	lanes.PV2[voiceidx]	= vc.PV2;
+	lanes.PV3[voiceidx]	= vc.PV3;
+	lanes.PV4[voiceidx]	= vc.PV4;
+	lanes.SP[voiceidx]	= vc.SP;
+
+	lanes.DryL[voiceidx]	= thiscore.VoiceGates[voiceidx].DryL;
+	lanes.DryR[voiceidx]	= thiscore.VoiceGates[voiceidx].DryR;
+	lanes.WetL[voiceidx]	= thiscore.VoiceGates[voiceidx].WetL;
+	lanes.WetR[voiceidx]	= thiscore.VoiceGates[voiceidx].WetR;
+}
+
+// Returns a 16 bit result in Value.
+static __forceinline s32 InterpolateVoice( const VoiceLanes& lanes, uint voiceidx )
+{
+	const s32 PV1 = lanes.PV1[voiceidx];
+	const s32 PV2 = lanes.PV2[voiceidx];
+	const s32 PV3 = lanes.PV3[voiceidx];
+	const s32 PV4 = lanes.PV4[voiceidx];
+	const s32 SP  = lanes.SP[voiceidx];
+	const s32 mu  = SP + 4096;
+
+	switch( Interpolation )
+	{
+		case 0: return PV1<<1;
+		case 1: return (PV1<<1) - (( (PV2 - PV1) * SP)>>11);
+
+		case 2: return CubicInterpolate				(PV4, PV3, PV2, PV1, mu);
+		case 3: return HermiteInterpolate<16384>	(PV4, PV3, PV2, PV1, mu);
+		case 4: return CatmullRomInterpolate		(PV4, PV3, PV2, PV1, mu);
+
+		jNO_DEFAULT;
+	}
+
+	return 0;		// technically unreachable!
+}
+
+// Reference implementation of the arithmetic half of the mixer, one voice at a time.
+static __forceinline void MixVoiceLanesScalar( VoiceMixSet& dest, const VoiceLanes& lanes )
+{
+	for( uint voiceidx=0; voiceidx<V_Core::NumVoices; ++voiceidx )
+	{
+		s32 Value = lanes.Noise[voiceidx] ? lanes.NoiseVal[voiceidx] : InterpolateVoice( lanes, voiceidx );
+		Value = MulShr32( Value, lanes.Envelope[voiceidx] );
+
+		// Note: Results from ApplyVolume are ranged at 16 bits.
+
+		const StereoOut32 VVal( ApplyVolume( Value, lanes.VolL[voiceidx] ), ApplyVolume( Value, lanes.VolR[voiceidx] ) );
+
+		dest.Dry.Left	+= VVal.Left	& lanes.DryL[voiceidx];
+		dest.Dry.Right	+= VVal.Right	& lanes.DryR[voiceidx];
+		dest.Wet.Left	+= VVal.Left	& lanes.WetL[voiceidx];
+		dest.Wet.Right	+= VVal.Right	& lanes.WetR[voiceidx];
+	}
+}
+
+static __forceinline s32 HorizontalSum( const __m128i& v )
+{
+	const __m128i s = _mm_add_epi32( v, _mm_shuffle_epi32( v, _MM_SHUFFLE(1,0,3,2) ) );
+	return _mm_cvtsi128_si32( _mm_add_epi32( s, _mm_shuffle_epi32( s, _MM_SHUFFLE(2,3,0,1) ) ) );
+}
+
+// Four-wide versions of the interpolators above; see them for the 16.0 / 0.12 fixed point
+// formats.  Multiplies by constants are done as shifts and adds (same wrapping result).
+template< int InterpType >
+static __forceinline __m128i InterpolateVoices( const VoiceLanes& lanes, uint voiceidx )
+{
+	const __m128i y3 = _mm_load_si128( (const __m128i*)&lanes.PV1[voiceidx] );
+	const __m128i y2 = _mm_load_si128( (const __m128i*)&lanes.PV2[voiceidx] );
+	const __m128i sp = _mm_load_si128( (const __m128i*)&lanes.SP[voiceidx] );
+
+	if( InterpType == 0 )
+		return _mm_slli_epi32( y3, 1 );
+
+	if( InterpType == 1 )
+		return _mm_sub_epi32( _mm_slli_epi32( y3, 1 ), _mm_srai_epi32( mullo_epi32( _mm_sub_epi32( y2, y3 ), sp ), 11 ) );
+
+	const __m128i y1 = _mm_load_si128( (const __m128i*)&lanes.PV3[voiceidx] );
+	const __m128i y0 = _mm_load_si128( (const __m128i*)&lanes.PV4[voiceidx] );
+	const __m128i mu = _mm_add_epi32( sp, _mm_set1_epi32( 4096 ) );
+
+	if( InterpType == 2 )		// Cubic
+	{
+		const __m128i a0 = _mm_add_epi32( _mm_sub_epi32( _mm_sub_epi32( y3, y2 ), y0 ), y1 );
+		const __m128i a1 = _mm_sub_epi32( _mm_sub_epi32( y0, y1 ), a0 );
+		const __m128i a2 = _mm_sub_epi32( y2, y0 );
+
+		__m128i val = _mm_srai_epi32( mullo_epi32( a0, mu ), 12 );
+		val = _mm_srai_epi32( mullo_epi32( _mm_add_epi32( val, a1 ), mu ), 12 );
+		val = _mm_srai_epi32( mullo_epi32( _mm_add_epi32( val, a2 ), mu ), 11 );
+		return _mm_add_epi32( val, _mm_slli_epi32( y1, 1 ) );
+	}
+
+	if( InterpType == 3 )		// Hermite, tension 16384 (x*16384 is x<<14)
+	{
+		const __m128i m00 = _mm_srai_epi32( _mm_slli_epi32( _mm_sub_epi32( y1, y0 ), 14 ), 16 );
+		const __m128i m01 = _mm_srai_epi32( _mm_slli_epi32( _mm_sub_epi32( y2, y1 ), 14 ), 16 );
+		const __m128i m11 = _mm_srai_epi32( _mm_slli_epi32( _mm_sub_epi32( y3, y2 ), 14 ), 16 );
+		const __m128i m0  = _mm_add_epi32( m00, m01 );
+		const __m128i m1  = _mm_add_epi32( m01, m11 );
+
+		const __m128i y1x3 = _mm_add_epi32( y1, _mm_slli_epi32( y1, 1 ) );
+		const __m128i y2x3 = _mm_add_epi32( y2, _mm_slli_epi32( y2, 1 ) );
+
+		__m128i val = _mm_sub_epi32( _mm_add_epi32( _mm_add_epi32( _mm_slli_epi32( y1, 1 ), m0 ), m1 ), _mm_slli_epi32( y2, 1 ) );
+		val = _mm_srai_epi32( mullo_epi32( val, mu ), 12 );
+		val = _mm_add_epi32( _mm_sub_epi32( _mm_sub_epi32( _mm_sub_epi32( val, y1x3 ), _mm_slli_epi32( m0, 1 ) ), m1 ), y2x3 );
+		val = _mm_srai_epi32( mullo_epi32( val, mu ), 12 );
+		val = _mm_srai_epi32( mullo_epi32( _mm_add_epi32( val, m0 ), mu ), 11 );
+		return _mm_add_epi32( val, _mm_slli_epi32( y1, 1 ) );
+	}
+
+	// Catmull-Rom
+	const __m128i y1x3 = _mm_add_epi32( y1, _mm_slli_epi32( y1, 1 ) );
+	const __m128i y2x3 = _mm_add_epi32( y2, _mm_slli_epi32( y2, 1 ) );
+	const __m128i y1x5 = _mm_add_epi32( y1, _mm_slli_epi32( y1, 2 ) );
+
+	const __m128i a3 = _mm_add_epi32( _mm_sub_epi32( _mm_sub_epi32( y1x3, y0 ), y2x3 ), y3 );
+	const __m128i a2 = _mm_sub_epi32( _mm_add_epi32( _mm_sub_epi32( _mm_slli_epi32( y0, 1 ), y1x5 ), _mm_slli_epi32( y2, 2 ) ), y3 );
+	const __m128i a1 = _mm_sub_epi32( y2, y0 );
+	const __m128i a0 = _mm_slli_epi32( y1, 1 );
+
+	__m128i val = _mm_srai_epi32( mullo_epi32( a3, mu ), 12 );
+	val = _mm_srai_epi32( mullo_epi32( _mm_add_epi32( a2, val ), mu ), 12 );
+	val = _mm_srai_epi32( mullo_epi32( _mm_add_epi32( a1, val ), mu ), 12 );
+	return _mm_add_epi32( a0, val );
+}
+
+template< int InterpType >
+static __forceinline void MixVoiceLanes( VoiceMixSet& dest, const VoiceLanes& lanes )
+{
+	__m128i dryL = _mm_setzero_si128();
+	__m128i dryR = _mm_setzero_si128();
+	__m128i wetL = _mm_setzero_si128();
+	__m128i wetR = _mm_setzero_si128();
+
+	for( uint voiceidx=0; voiceidx<V_Core::NumVoices; voiceidx+=4 )
+	{
+		const __m128i noise = _mm_load_si128( (const __m128i*)&lanes.Noise[voiceidx] );
+
+		__m128i value = InterpolateVoices<InterpType>( lanes, voiceidx );
+		value = _mm_or_si128( _mm_and_si128( noise, _mm_load_si128( (const __m128i*)&lanes.NoiseVal[voiceidx] ) ), _mm_andnot_si128( noise, value ) );
+		value = mulhi_epi32( value, _mm_load_si128( (const __m128i*)&lanes.Envelope[voiceidx] ) );
+
+		// ApplyVolume: data is shifted up by 1 bit to give the output an effective 16 bit range.
+		value = _mm_slli_epi32( value, 1 );
+		const __m128i left	= mulhi_epi32( value, _mm_load_si128( (const __m128i*)&lanes.VolL[voiceidx] ) );
+		const __m128i right	= mulhi_epi32( value, _mm_load_si128( (const __m128i*)&lanes.VolR[voiceidx] ) );
+
+		dryL = _mm_add_epi32( dryL, _mm_and_si128( left,	_mm_load_si128( (const __m128i*)&lanes.DryL[voiceidx] ) ) );
+		dryR = _mm_add_epi32( dryR, _mm_and_si128( right,	_mm_load_si128( (const __m128i*)&lanes.DryR[voiceidx] ) ) );
+		wetL = _mm_add_epi32( wetL, _mm_and_si128( left,	_mm_load_si128( (const __m128i*)&lanes.WetL[voiceidx] ) ) );
+		wetR = _mm_add_epi32( wetR, _mm_and_si128( right,	_mm_load_si128( (const __m128i*)&lanes.WetR[voiceidx] ) ) );
 	}
+
+	dest.Dry.Left	+= HorizontalSum( dryL );
+	dest.Dry.Right	+= HorizontalSum( dryR );
+	dest.Wet.Left	+= HorizontalSum( wetL );
+	dest.Wet.Right	+= HorizontalSum( wetR );
 }
 
 const VoiceMixSet VoiceMixSet::Empty( (StereoOut32()), (StereoOut32()) );	// Don't use SteroOut32::Empty because C++ doesn't make any dep/order checks on global initializers.
 
+// Verification path for s2r_verify: mixes the lanes with both the scalar reference and the
+// SSE2 code and counts the samples where they differ.  The scalar result is the one output.
+static __noinline void MixCoreVoicesVerify( VoiceMixSet& dest, const uint coreidx, const VoiceLanes& lanes )
+{
+	VoiceMixSet simd( dest );
+
+	switch( Interpolation )
+	{
+		case 0: MixVoiceLanes<0>( simd, lanes ); break;
+		case 1: MixVoiceLanes<1>( simd, lanes ); break;
+		case 2: MixVoiceLanes<2>( simd, lanes ); break;
+		case 3: MixVoiceLanes<3>( simd, lanes ); break;
+		case 4: MixVoiceLanes<4>( simd, lanes ); break;
+
+		jNO_DEFAULT;
+	}
+
+	MixVoiceLanesScalar( dest, lanes );
+
+	VoiceMixVerifySamples++;
+
+	if( dest.Dry.Left != simd.Dry.Left || dest.Dry.Right != simd.Dry.Right
+		|| dest.Wet.Left != simd.Wet.Left || dest.Wet.Right != simd.Wet.Right )
+	{
+		if( VoiceMixVerifyMismatches++ < 16 )
+		{
+			ConLog( "* SPU2-X: Core %u voice mix mismatch at sample %llu (interpolation %d): scalar %d,%d %d,%d simd %d,%d %d,%d\n",
+				coreidx, VoiceMixVerifySamples, Interpolation,
+				dest.Dry.Left, dest.Dry.Right, dest.Wet.Left, dest.Wet.Right,
+				simd.Dry.Left, simd.Dry.Right, simd.Wet.Left, simd.Wet.Right );
+		}
+	}
+}
+
 static __forceinline void MixCoreVoices( VoiceMixSet& dest, const uint coreidx )
 {
-	V_Core& thiscore( Cores[coreidx] );
+	static VoiceLanes lanes;
 
 	for( uint voiceidx=0; voiceidx<V_Core::NumVoices; ++voiceidx )
+		UpdateVoice( lanes, coreidx, voiceidx );
+
+	if( VoiceMixVerify )
 	{
-		StereoOut32 VVal( MixVoice( coreidx, voiceidx ) );
+		MixCoreVoicesVerify( dest, coreidx, lanes );
+		return;
+	}
 
-		// Note: Results from MixVoice are ranged at 16 bits.
+	switch( Interpolation )
+	{
+		case 0: MixVoiceLanes<0>( dest, lanes ); break;
+		case 1: MixVoiceLanes<1>( dest, lanes ); break;
+		case 2: MixVoiceLanes<2>( dest, lanes ); break;
+		case 3: MixVoiceLanes<3>( dest, lanes ); break;
+		case 4: MixVoiceLanes<4>( dest, lanes ); break;
 
-		dest.Dry.Left	+= VVal.Left	& thiscore.VoiceGates[voiceidx].DryL;
-		dest.Dry.Right	+= VVal.Right	& thiscore.VoiceGates[voiceidx].DryR;
-		dest.Wet.Left	+= VVal.Left	& thiscore.VoiceGates[voiceidx].WetL;
-		dest.Wet.Right	+= VVal.Right	& thiscore.VoiceGates[voiceidx].WetR;
+		jNO_DEFAULT;
 	}
 }
 
@@ -937,13 +1181,18 @@ void Mix()
 		if(p_cachestat_counter > (48000*10) )
 		{
 			p_cachestat_counter = 0;
-			if( MsgCache() ) ConLog( " * SPU2 > CacheStats > Hits: %d  Misses: %d  Ignores: %d\n",
+			const int lookups = g_counter_cache_hits + g_counter_cache_misses + g_counter_cache_predictor_misses;
+
+			if( MsgCache() ) ConLog( " * SPU2 > CacheStats > Hits: %d  Misses: %d  Predictor Misses: %d  Ignores: %d  (Hit Rate: %.1f%%)\n",
 				g_counter_cache_hits,
 				g_counter_cache_misses,
-				g_counter_cache_ignores );
+				g_counter_cache_predictor_misses,
+				g_counter_cache_ignores,
+				lookups ? (g_counter_cache_hits * 100.0 / lookups) : 0.0 );
 
 			g_counter_cache_hits =
 			g_counter_cache_misses =
+			g_counter_cache_predictor_misses =
 			g_counter_cache_ignores = 0;
 		}
 	}
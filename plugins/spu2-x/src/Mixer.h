@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <emmintrin.h>
+
 // Implemented in Config.cpp
 extern float VolumeAdjustFL;
 extern float VolumeAdjustFR;
@@ -133,6 +135,43 @@ struct FrequencyResponseFilter
 };
 
 extern void	Mix();
+
+extern bool	VoiceMixVerify;
+extern u64	VoiceMixVerifySamples;
+extern u64	VoiceMixVerifyMismatches;
+extern bool	ReverbVerify;
+extern u64	ReverbVerifySamples;
+extern u64	ReverbVerifyMismatches;
 extern s32	clamp_mix( s32 x, u8 bitshift=0 );
 
 extern StereoOut32 clamp_mix( const StereoOut32& sample, u8 bitshift=0 );
+
+// SSE2 has no 32 bit multiplies; these build them out of pmuludq.  Both are bit-exact
+// with their scalar counterparts (wrapping s32 multiply, and the high half of the s64
+// product as returned by MulShr32).
+static __forceinline __m128i mullo_epi32( const __m128i& a, const __m128i& b )
+{
+	const __m128i even	= _mm_mul_epu32( a, b );
+	const __m128i odd	= _mm_mul_epu32( _mm_srli_epi64( a, 32 ), _mm_srli_epi64( b, 32 ) );
+
+	return _mm_unpacklo_epi32( _mm_shuffle_epi32( even, _MM_SHUFFLE(0,0,2,0) ), _mm_shuffle_epi32( odd, _MM_SHUFFLE(0,0,2,0) ) );
+}
+
+static __forceinline __m128i mulhi_epi32( const __m128i& a, const __m128i& b )
+{
+	const __m128i even	= _mm_mul_epu32( a, b );
+	const __m128i odd	= _mm_mul_epu32( _mm_srli_epi64( a, 32 ), _mm_srli_epi64( b, 32 ) );
+	__m128i hi			= _mm_unpacklo_epi32( _mm_shuffle_epi32( even, _MM_SHUFFLE(3,1,3,1) ), _mm_shuffle_epi32( odd, _MM_SHUFFLE(3,1,3,1) ) );
+
+	// Unsigned -> signed high half: subtract b where a is negative and a where b is negative.
+	hi = _mm_sub_epi32( hi, _mm_and_si128( _mm_srai_epi32( a, 31 ), b ) );
+	hi = _mm_sub_epi32( hi, _mm_and_si128( _mm_srai_epi32( b, 31 ), a ) );
+	return hi;
+}
+
+// Four-wide clamp_mix( x ): saturates each s32 lane to the s16 range.
+static __forceinline __m128i clamp_mix( const __m128i& x )
+{
+	const __m128i packed = _mm_packs_epi32( x, x );
+	return _mm_srai_epi32( _mm_unpacklo_epi16( packed, packed ), 16 );
+}
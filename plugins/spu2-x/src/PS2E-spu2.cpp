@@ -349,10 +349,10 @@ EXPORT_C_(s32) SPU2init()
 
 	// adpcm decoder cache:
 	//  the cache data size is determined by taking the number of adpcm blocks
-	//  (2MB / 16) and multiplying it by the decoded block size (28 samples).
-	//  Thus: pcm_cache_data = 7,340,032 bytes (ouch!)
-	//  Expanded: 16 bytes expands to 56 bytes [3.5:1 ratio]
-	//    Resulting in 2MB * 3.5.
+	//  (2MB / 16) and multiplying it by sizeof(PcmCacheEntry): the decoded block
+	//  (28 samples, 56 bytes) plus the valid flag and the Prev1/Prev2 predictor
+	//  history it was decoded from, 62 bytes in all.
+	//  Thus: pcm_cache_data = 131,072 * 62 = 8,126,464 bytes (ouch!)
 
 	pcm_cache_data = (PcmCacheEntry*)calloc( pcm_BlockCount, sizeof(PcmCacheEntry) );
 
@@ -81,6 +81,12 @@ EXPORT_C_(void) SPU2configure();
 EXPORT_C_(void) SPU2about();
 EXPORT_C_(s32)  SPU2test();
 
+#ifndef _MSC_VER
+// Replays an s2r log with the voice mixer cross-check enabled (see Spu2replay.cpp).  On
+// Windows the same entry point is exported as SPU2verify by Spu2-X.def.
+EXPORT_C_(void) SPU2verify(const char* filename);
+#endif
+
 #include "Spu2replay.h"
 
 extern u8 callirq;
@@ -55,6 +55,189 @@ void V_Core::Reverb_AdvanceBuffer()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+// When set, every reverb step is computed by both the scalar reference and the SSE2 code,
+// from the same work area contents, and the results are compared (see s2r_verify).  The
+// scalar result is the one that is output and left in SPU2 RAM.
+bool ReverbVerify = false;
+u64 ReverbVerifySamples = 0;
+u64 ReverbVerifyMismatches = 0;
+
+// Work area addresses used by one reverb step, as returned by RevbGetIndexer.
+struct ReverbTaps
+{
+	u32 src_a0, src_a1, src_b0, src_b1;
+	u32 dest_a0, dest_a1, dest_b0, dest_b1;
+	u32 dest2_a0, dest2_a1, dest2_b0, dest2_b1;
+	u32 acc_src_a0, acc_src_b0, acc_src_c0, acc_src_d0;
+	u32 acc_src_a1, acc_src_b1, acc_src_c1, acc_src_d1;
+	u32 fb_src_a0, fb_src_a1, fb_src_b0, fb_src_b1;
+	u32 mix_dest_a0, mix_dest_a1, mix_dest_b0, mix_dest_b1;
+};
+
+// Reference implementation of the reverb filters: reads the taps, writes the IIR and mix
+// results back into the work area, and returns the wet sample for the upsampler.
+static __forceinline StereoOut32 ReverbStepScalar( const V_Reverb& Revb, const ReverbTaps& t, s32 input_L, s32 input_R )
+{
+	const s32 IIR_INPUT_A0 = clamp_mix((((s32)_spu2mem[t.src_a0] * Revb.IIR_COEF) + input_L)>>15);
+	const s32 IIR_INPUT_A1 = clamp_mix((((s32)_spu2mem[t.src_a1] * Revb.IIR_COEF) + input_L)>>15);
+	const s32 IIR_INPUT_B0 = clamp_mix((((s32)_spu2mem[t.src_b0] * Revb.IIR_COEF) + input_R)>>15);
+	const s32 IIR_INPUT_B1 = clamp_mix((((s32)_spu2mem[t.src_b1] * Revb.IIR_COEF) + input_R)>>15);
+
+	const s32 src_dest_a0 = _spu2mem[t.dest_a0];
+	const s32 src_dest_a1 = _spu2mem[t.dest_a1];
+	const s32 src_dest_b0 = _spu2mem[t.dest_b0];
+	const s32 src_dest_b1 = _spu2mem[t.dest_b1];
+
+	// This section differs from Neill's doc as it uses single-mul interpolation instead
+	// of 0x8000-val inversion.  (same result, faster)
+	const s32 IIR_A0 = src_dest_a0 + (((IIR_INPUT_A0 - src_dest_a0) * Revb.IIR_ALPHA)>>15);
+	const s32 IIR_A1 = src_dest_a1 + (((IIR_INPUT_A1 - src_dest_a1) * Revb.IIR_ALPHA)>>15);
+	const s32 IIR_B0 = src_dest_b0 + (((IIR_INPUT_B0 - src_dest_b0) * Revb.IIR_ALPHA)>>15);
+	const s32 IIR_B1 = src_dest_b1 + (((IIR_INPUT_B1 - src_dest_b1) * Revb.IIR_ALPHA)>>15);
+	_spu2mem[t.dest2_a0] = clamp_mix( IIR_A0 );
+	_spu2mem[t.dest2_a1] = clamp_mix( IIR_A1 );
+	_spu2mem[t.dest2_b0] = clamp_mix( IIR_B0 );
+	_spu2mem[t.dest2_b1] = clamp_mix( IIR_B1 );
+
+	const s32 ACC0 = clamp_mix(
+		((_spu2mem[t.acc_src_a0] * Revb.ACC_COEF_A) >> 15) +
+		((_spu2mem[t.acc_src_b0] * Revb.ACC_COEF_B) >> 15) +
+		((_spu2mem[t.acc_src_c0] * Revb.ACC_COEF_C) >> 15) +
+		((_spu2mem[t.acc_src_d0] * Revb.ACC_COEF_D) >> 15)
+	);
+
+	const s32 ACC1 = clamp_mix(
+		((_spu2mem[t.acc_src_a1] * Revb.ACC_COEF_A) >> 15) +
+		((_spu2mem[t.acc_src_b1] * Revb.ACC_COEF_B) >> 15) +
+		((_spu2mem[t.acc_src_c1] * Revb.ACC_COEF_C) >> 15) +
+		((_spu2mem[t.acc_src_d1] * Revb.ACC_COEF_D) >> 15)
+	);
+
+	// The following code differs from Neill's doc as it uses the more natural single-mul
+	// interpolative, instead of the funky ^0x8000 stuff.  (better result, faster)
+
+	const s32 FB_A0 = _spu2mem[t.fb_src_a0];
+	const s32 FB_A1 = _spu2mem[t.fb_src_a1];
+	const s32 FB_B0 = _spu2mem[t.fb_src_b0];
+	const s32 FB_B1 = _spu2mem[t.fb_src_b1];
+
+	const s32 mix_a0 = clamp_mix(ACC0 - ((FB_A0 * Revb.FB_ALPHA) >> 15));
+	const s32 mix_a1 = clamp_mix(ACC1 - ((FB_A1 * Revb.FB_ALPHA) >> 15));
+	const s32 mix_b0 = clamp_mix(FB_A0 + (((ACC0 - FB_A0) * Revb.FB_ALPHA - FB_B0 * Revb.FB_X) >> 15));
+	const s32 mix_b1 = clamp_mix(FB_A1 + (((ACC1 - FB_A1) * Revb.FB_ALPHA - FB_B1 * Revb.FB_X) >> 15));
+
+	_spu2mem[t.mix_dest_a0] = mix_a0;
+	_spu2mem[t.mix_dest_a1] = mix_a1;
+	_spu2mem[t.mix_dest_b0] = mix_b0;
+	_spu2mem[t.mix_dest_b1] = mix_b1;
+
+	return clamp_mix( StereoOut32(
+		mix_a0 + mix_b0,	// left
+		mix_a1 + mix_b1		// right
+	) );
+}
+
+// SSE2 version of ReverbStepScalar.  The four IIR filters run side by side, lanes ordered
+// A0, A1, B0, B1.  Reads and writes of the work area happen in the same order as the
+// scalar code, since taps are allowed to alias.
+static __forceinline StereoOut32 ReverbStep( const V_Reverb& Revb, const ReverbTaps& t, s32 input_L, s32 input_R )
+{
+	const __m128i IIR_INPUT = clamp_mix( _mm_srai_epi32( _mm_add_epi32(
+		mullo_epi32( _mm_setr_epi32( _spu2mem[t.src_a0], _spu2mem[t.src_a1], _spu2mem[t.src_b0], _spu2mem[t.src_b1] ), _mm_set1_epi32( Revb.IIR_COEF ) ),
+		_mm_setr_epi32( input_L, input_L, input_R, input_R ) ), 15 ) );
+
+	const __m128i src_dest = _mm_setr_epi32( _spu2mem[t.dest_a0], _spu2mem[t.dest_a1], _spu2mem[t.dest_b0], _spu2mem[t.dest_b1] );
+
+	__aligned16 s32 IIR[4];
+	_mm_store_si128( (__m128i*)IIR, clamp_mix( _mm_add_epi32( src_dest,
+		_mm_srai_epi32( mullo_epi32( _mm_sub_epi32( IIR_INPUT, src_dest ), _mm_set1_epi32( Revb.IIR_ALPHA ) ), 15 ) ) ) );
+
+	_spu2mem[t.dest2_a0] = IIR[0];
+	_spu2mem[t.dest2_a1] = IIR[1];
+	_spu2mem[t.dest2_b0] = IIR[2];
+	_spu2mem[t.dest2_b1] = IIR[3];
+
+	// Comb taps: one vector per channel, summed across lanes into ACC0, ACC1, ACC0, ACC1.
+	const __m128i acc_coefs = _mm_setr_epi32( Revb.ACC_COEF_A, Revb.ACC_COEF_B, Revb.ACC_COEF_C, Revb.ACC_COEF_D );
+	const __m128i acc0 = _mm_srai_epi32( mullo_epi32( _mm_setr_epi32( _spu2mem[t.acc_src_a0], _spu2mem[t.acc_src_b0], _spu2mem[t.acc_src_c0], _spu2mem[t.acc_src_d0] ), acc_coefs ), 15 );
+	const __m128i acc1 = _mm_srai_epi32( mullo_epi32( _mm_setr_epi32( _spu2mem[t.acc_src_a1], _spu2mem[t.acc_src_b1], _spu2mem[t.acc_src_c1], _spu2mem[t.acc_src_d1] ), acc_coefs ), 15 );
+
+	__m128i ACC = _mm_add_epi32( _mm_unpacklo_epi32( acc0, acc1 ), _mm_unpackhi_epi32( acc0, acc1 ) );
+	ACC = clamp_mix( _mm_add_epi32( ACC, _mm_shuffle_epi32( ACC, _MM_SHUFFLE(1,0,3,2) ) ) );
+
+	// Feedback lanes are channel 0, 1 (duplicated into 2, 3).
+
+	const s32 FB_A0 = _spu2mem[t.fb_src_a0];
+	const s32 FB_A1 = _spu2mem[t.fb_src_a1];
+	const s32 FB_B0 = _spu2mem[t.fb_src_b0];
+	const s32 FB_B1 = _spu2mem[t.fb_src_b1];
+
+	const __m128i FB_A		= _mm_setr_epi32( FB_A0, FB_A1, FB_A0, FB_A1 );
+	const __m128i FB_B		= _mm_setr_epi32( FB_B0, FB_B1, FB_B0, FB_B1 );
+	const __m128i FB_ALPHA	= _mm_set1_epi32( Revb.FB_ALPHA );
+
+	__aligned16 s32 mix_a[4];
+	__aligned16 s32 mix_b[4];
+
+	_mm_store_si128( (__m128i*)mix_a, clamp_mix( _mm_sub_epi32( ACC, _mm_srai_epi32( mullo_epi32( FB_A, FB_ALPHA ), 15 ) ) ) );
+	_mm_store_si128( (__m128i*)mix_b, clamp_mix( _mm_add_epi32( FB_A, _mm_srai_epi32( _mm_sub_epi32(
+		mullo_epi32( _mm_sub_epi32( ACC, FB_A ), FB_ALPHA ), mullo_epi32( FB_B, _mm_set1_epi32( Revb.FB_X ) ) ), 15 ) ) ) );
+
+	_spu2mem[t.mix_dest_a0] = mix_a[0];
+	_spu2mem[t.mix_dest_a1] = mix_a[1];
+	_spu2mem[t.mix_dest_b0] = mix_b[0];
+	_spu2mem[t.mix_dest_b1] = mix_b[1];
+
+	return clamp_mix( StereoOut32(
+		mix_a[0] + mix_b[0],	// left
+		mix_a[1] + mix_b[1]		// right
+	) );
+}
+
+// Verification path for s2r_verify.  Both steps write the same eight work area words, so
+// the SSE2 step runs first, its words are saved and the old ones put back, and then the
+// scalar step runs from the same state.
+static __noinline StereoOut32 ReverbStepVerify( uint coreidx, const V_Reverb& Revb, const ReverbTaps& t, s32 input_L, s32 input_R )
+{
+	const u32 dests[8] =
+	{
+		t.dest2_a0, t.dest2_a1, t.dest2_b0, t.dest2_b1,
+		t.mix_dest_a0, t.mix_dest_a1, t.mix_dest_b0, t.mix_dest_b1
+	};
+
+	s16 prev[8], simd[8];
+
+	for( int i=0; i<8; ++i )
+		prev[i] = _spu2mem[dests[i]];
+
+	const StereoOut32 simdOut( ReverbStep( Revb, t, input_L, input_R ) );
+
+	for( int i=0; i<8; ++i )
+		simd[i] = _spu2mem[dests[i]];
+
+	for( int i=0; i<8; ++i )
+		_spu2mem[dests[i]] = prev[i];
+
+	const StereoOut32 out( ReverbStepScalar( Revb, t, input_L, input_R ) );
+
+	bool match = (out.Left == simdOut.Left) && (out.Right == simdOut.Right);
+
+	for( int i=0; i<8; ++i )
+		match = match && (_spu2mem[dests[i]] == simd[i]);
+
+	ReverbVerifySamples++;
+
+	if( !match && (ReverbVerifyMismatches++ < 16) )
+	{
+		ConLog( "* SPU2-X: Core %u reverb mismatch at step %llu: scalar %d,%d simd %d,%d\n",
+			coreidx, ReverbVerifySamples, out.Left, out.Right, simdOut.Left, simdOut.Right );
+	}
+
+	return out;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 StereoOut32 V_Core::DoReverb( const StereoOut32& Input )
 {
 #if 0
@@ -96,40 +279,42 @@ StereoOut32 V_Core::DoReverb( const StereoOut32& Input )
 		// Advance the current reverb buffer pointer, and cache the read/write addresses we'll be
 		// needing for this session of reverb.
 
-		const u32 src_a0 = RevbGetIndexer( RevBuffers.IIR_SRC_A0 );
-		const u32 src_a1 = RevbGetIndexer( RevBuffers.IIR_SRC_A1 );
-		const u32 src_b0 = RevbGetIndexer( RevBuffers.IIR_SRC_B0 );
-		const u32 src_b1 = RevbGetIndexer( RevBuffers.IIR_SRC_B1 );
-
-		const u32 dest_a0 = RevbGetIndexer( RevBuffers.IIR_DEST_A0 );
-		const u32 dest_a1 = RevbGetIndexer( RevBuffers.IIR_DEST_A1 );
-		const u32 dest_b0 = RevbGetIndexer( RevBuffers.IIR_DEST_B0 );
-		const u32 dest_b1 = RevbGetIndexer( RevBuffers.IIR_DEST_B1 );
-
-		const u32 dest2_a0 = RevbGetIndexer( RevBuffers.IIR_DEST_A0 + 1 );
-		const u32 dest2_a1 = RevbGetIndexer( RevBuffers.IIR_DEST_A1 + 1 );
-		const u32 dest2_b0 = RevbGetIndexer( RevBuffers.IIR_DEST_B0 + 1 );
-		const u32 dest2_b1 = RevbGetIndexer( RevBuffers.IIR_DEST_B1 + 1 );
-
-		const u32 acc_src_a0 = RevbGetIndexer( RevBuffers.ACC_SRC_A0 );
-		const u32 acc_src_b0 = RevbGetIndexer( RevBuffers.ACC_SRC_B0 );
-		const u32 acc_src_c0 = RevbGetIndexer( RevBuffers.ACC_SRC_C0 );
-		const u32 acc_src_d0 = RevbGetIndexer( RevBuffers.ACC_SRC_D0 );
-
-		const u32 acc_src_a1 = RevbGetIndexer( RevBuffers.ACC_SRC_A1 );
-		const u32 acc_src_b1 = RevbGetIndexer( RevBuffers.ACC_SRC_B1 );
-		const u32 acc_src_c1 = RevbGetIndexer( RevBuffers.ACC_SRC_C1 );
-		const u32 acc_src_d1 = RevbGetIndexer( RevBuffers.ACC_SRC_D1 );
-
-		const u32 fb_src_a0 = RevbGetIndexer( RevBuffers.FB_SRC_A0 );
-		const u32 fb_src_a1 = RevbGetIndexer( RevBuffers.FB_SRC_A1 );
-		const u32 fb_src_b0 = RevbGetIndexer( RevBuffers.FB_SRC_B0 );
-		const u32 fb_src_b1 = RevbGetIndexer( RevBuffers.FB_SRC_B1 );
-
-		const u32 mix_dest_a0 = RevbGetIndexer( RevBuffers.MIX_DEST_A0 );
-		const u32 mix_dest_a1 = RevbGetIndexer( RevBuffers.MIX_DEST_A1 );
-		const u32 mix_dest_b0 = RevbGetIndexer( RevBuffers.MIX_DEST_B0 );
-		const u32 mix_dest_b1 = RevbGetIndexer( RevBuffers.MIX_DEST_B1 );
+		ReverbTaps t;
+
+		t.src_a0 = RevbGetIndexer( RevBuffers.IIR_SRC_A0 );
+		t.src_a1 = RevbGetIndexer( RevBuffers.IIR_SRC_A1 );
+		t.src_b0 = RevbGetIndexer( RevBuffers.IIR_SRC_B0 );
+		t.src_b1 = RevbGetIndexer( RevBuffers.IIR_SRC_B1 );
+
+		t.dest_a0 = RevbGetIndexer( RevBuffers.IIR_DEST_A0 );
+		t.dest_a1 = RevbGetIndexer( RevBuffers.IIR_DEST_A1 );
+		t.dest_b0 = RevbGetIndexer( RevBuffers.IIR_DEST_B0 );
+		t.dest_b1 = RevbGetIndexer( RevBuffers.IIR_DEST_B1 );
+
+		t.dest2_a0 = RevbGetIndexer( RevBuffers.IIR_DEST_A0 + 1 );
+		t.dest2_a1 = RevbGetIndexer( RevBuffers.IIR_DEST_A1 + 1 );
+		t.dest2_b0 = RevbGetIndexer( RevBuffers.IIR_DEST_B0 + 1 );
+		t.dest2_b1 = RevbGetIndexer( RevBuffers.IIR_DEST_B1 + 1 );
+
+		t.acc_src_a0 = RevbGetIndexer( RevBuffers.ACC_SRC_A0 );
+		t.acc_src_b0 = RevbGetIndexer( RevBuffers.ACC_SRC_B0 );
+		t.acc_src_c0 = RevbGetIndexer( RevBuffers.ACC_SRC_C0 );
+		t.acc_src_d0 = RevbGetIndexer( RevBuffers.ACC_SRC_D0 );
+
+		t.acc_src_a1 = RevbGetIndexer( RevBuffers.ACC_SRC_A1 );
+		t.acc_src_b1 = RevbGetIndexer( RevBuffers.ACC_SRC_B1 );
+		t.acc_src_c1 = RevbGetIndexer( RevBuffers.ACC_SRC_C1 );
+		t.acc_src_d1 = RevbGetIndexer( RevBuffers.ACC_SRC_D1 );
+
+		t.fb_src_a0 = RevbGetIndexer( RevBuffers.FB_SRC_A0 );
+		t.fb_src_a1 = RevbGetIndexer( RevBuffers.FB_SRC_A1 );
+		t.fb_src_b0 = RevbGetIndexer( RevBuffers.FB_SRC_B0 );
+		t.fb_src_b1 = RevbGetIndexer( RevBuffers.FB_SRC_B1 );
+
+		t.mix_dest_a0 = RevbGetIndexer( RevBuffers.MIX_DEST_A0 );
+		t.mix_dest_a1 = RevbGetIndexer( RevBuffers.MIX_DEST_A1 );
+		t.mix_dest_b0 = RevbGetIndexer( RevBuffers.MIX_DEST_B0 );
+		t.mix_dest_b1 = RevbGetIndexer( RevBuffers.MIX_DEST_B1 );
 
 		// -----------------------------------------
 		//          Optimized IRQ Testing !
@@ -138,31 +323,31 @@ StereoOut32 V_Core::DoReverb( const StereoOut32& Input )
 		// This test is enhanced by using the reverb effects area begin/end test as a
 		// shortcut, since all buffer addresses are within that area.  If the IRQA isn't
 		// within that zone then the "bulk" of the test is skipped, so this should only
-		// be a slowdown on a few evil games.
+		// be a slowdown on a few evil games.  The 28 taps are only packed into vectors
+		// once that test passes, and are then compared four at a time.
 
 		for( int i=0; i<2; i++ )
 		{
 			if( Cores[i].IRQEnable && ((Cores[i].IRQA >= EffectsStartA) && (Cores[i].IRQA <= EffectsEndA)) )
 			{
-				if(	(Cores[i].IRQA == src_a0)		||	(Cores[i].IRQA == src_a1)		||
-					(Cores[i].IRQA == src_b0)		||	(Cores[i].IRQA == src_b1)		||
-
-					(Cores[i].IRQA == dest_a0)		||	(Cores[i].IRQA == dest_a1)		||
-					(Cores[i].IRQA == dest_b0)		||	(Cores[i].IRQA == dest_b1)		||
-
-					(Cores[i].IRQA == dest2_a0)		||	(Cores[i].IRQA == dest2_a1)		||
-					(Cores[i].IRQA == dest2_b0)		||	(Cores[i].IRQA == dest2_b1)		||
-
-					(Cores[i].IRQA == acc_src_a0)	||	(Cores[i].IRQA == acc_src_a1)	||
-					(Cores[i].IRQA == acc_src_b0)	||	(Cores[i].IRQA == acc_src_b1)	||
-					(Cores[i].IRQA == acc_src_c0)	||	(Cores[i].IRQA == acc_src_c1)	||
-					(Cores[i].IRQA == acc_src_d0)	||	(Cores[i].IRQA == acc_src_d1)	||
-
-					(Cores[i].IRQA == fb_src_a0)	||	(Cores[i].IRQA == fb_src_a1)	||
-					(Cores[i].IRQA == fb_src_b0)	||	(Cores[i].IRQA == fb_src_b1)	||
-
-					(Cores[i].IRQA == mix_dest_a0)	||	(Cores[i].IRQA == mix_dest_a1)	||
-					(Cores[i].IRQA == mix_dest_b0)	||	(Cores[i].IRQA == mix_dest_b1) )
+				const __m128i taps[7] =
+				{
+					_mm_setr_epi32( t.src_a0, t.src_a1, t.src_b0, t.src_b1 ),
+					_mm_setr_epi32( t.dest_a0, t.dest_a1, t.dest_b0, t.dest_b1 ),
+					_mm_setr_epi32( t.dest2_a0, t.dest2_a1, t.dest2_b0, t.dest2_b1 ),
+					_mm_setr_epi32( t.acc_src_a0, t.acc_src_b0, t.acc_src_c0, t.acc_src_d0 ),
+					_mm_setr_epi32( t.acc_src_a1, t.acc_src_b1, t.acc_src_c1, t.acc_src_d1 ),
+					_mm_setr_epi32( t.fb_src_a0, t.fb_src_a1, t.fb_src_b0, t.fb_src_b1 ),
+					_mm_setr_epi32( t.mix_dest_a0, t.mix_dest_a1, t.mix_dest_b0, t.mix_dest_b1 ),
+				};
+
+				const __m128i irqa = _mm_set1_epi32( Cores[i].IRQA );
+				__m128i hit = _mm_setzero_si128();
+
+				for( int n=0; n<7; ++n )
+					hit = _mm_or_si128( hit, _mm_cmpeq_epi32( taps[n], irqa ) );
+
+				if( _mm_movemask_epi8( hit ) )
 				{
 					//printf("Core %d IRQ Called (Reverb). IRQA = %x\n",i,addr);
 					SetIrqCall(i);
@@ -188,63 +373,9 @@ StereoOut32 V_Core::DoReverb( const StereoOut32& Input )
 		s32 input_L = INPUT_SAMPLE.Left * Revb.IN_COEF_L;
 		s32 input_R = INPUT_SAMPLE.Right * Revb.IN_COEF_R;
 
-		const s32 IIR_INPUT_A0 = clamp_mix((((s32)_spu2mem[src_a0] * Revb.IIR_COEF) + input_L)>>15);
-		const s32 IIR_INPUT_A1 = clamp_mix((((s32)_spu2mem[src_a1] * Revb.IIR_COEF) + input_L)>>15);
-		const s32 IIR_INPUT_B0 = clamp_mix((((s32)_spu2mem[src_b0] * Revb.IIR_COEF) + input_R)>>15);
-		const s32 IIR_INPUT_B1 = clamp_mix((((s32)_spu2mem[src_b1] * Revb.IIR_COEF) + input_R)>>15);
-
-		const s32 src_dest_a0 = _spu2mem[dest_a0];
-		const s32 src_dest_a1 = _spu2mem[dest_a1];
-		const s32 src_dest_b0 = _spu2mem[dest_b0];
-		const s32 src_dest_b1 = _spu2mem[dest_b1];
-
-		// This section differs from Neill's doc as it uses single-mul interpolation instead
-		// of 0x8000-val inversion.  (same result, faster)
-		const s32 IIR_A0 = src_dest_a0 + (((IIR_INPUT_A0 - src_dest_a0) * Revb.IIR_ALPHA)>>15);
-		const s32 IIR_A1 = src_dest_a1 + (((IIR_INPUT_A1 - src_dest_a1) * Revb.IIR_ALPHA)>>15);
-		const s32 IIR_B0 = src_dest_b0 + (((IIR_INPUT_B0 - src_dest_b0) * Revb.IIR_ALPHA)>>15);
-		const s32 IIR_B1 = src_dest_b1 + (((IIR_INPUT_B1 - src_dest_b1) * Revb.IIR_ALPHA)>>15);
-		_spu2mem[dest2_a0] = clamp_mix( IIR_A0 );
-		_spu2mem[dest2_a1] = clamp_mix( IIR_A1 );
-		_spu2mem[dest2_b0] = clamp_mix( IIR_B0 );
-		_spu2mem[dest2_b1] = clamp_mix( IIR_B1 );
-
-		const s32 ACC0 = clamp_mix(
-			((_spu2mem[acc_src_a0] * Revb.ACC_COEF_A) >> 15) +
-			((_spu2mem[acc_src_b0] * Revb.ACC_COEF_B) >> 15) +
-			((_spu2mem[acc_src_c0] * Revb.ACC_COEF_C) >> 15) +
-			((_spu2mem[acc_src_d0] * Revb.ACC_COEF_D) >> 15)
-		);
-
-		const s32 ACC1 = clamp_mix(
-			((_spu2mem[acc_src_a1] * Revb.ACC_COEF_A) >> 15) +
-			((_spu2mem[acc_src_b1] * Revb.ACC_COEF_B) >> 15) +
-			((_spu2mem[acc_src_c1] * Revb.ACC_COEF_C) >> 15) +
-			((_spu2mem[acc_src_d1] * Revb.ACC_COEF_D) >> 15)
-		);
-
-		// The following code differs from Neill's doc as it uses the more natural single-mul
-		// interpolative, instead of the funky ^0x8000 stuff.  (better result, faster)
-
-		const s32 FB_A0 = _spu2mem[fb_src_a0];
-		const s32 FB_A1 = _spu2mem[fb_src_a1];
-		const s32 FB_B0 = _spu2mem[fb_src_b0];
-		const s32 FB_B1 = _spu2mem[fb_src_b1];
-
-		const s32 mix_a0 = clamp_mix(ACC0 - ((FB_A0 * Revb.FB_ALPHA) >> 15));
-		const s32 mix_a1 = clamp_mix(ACC1 - ((FB_A1 * Revb.FB_ALPHA) >> 15));
-		const s32 mix_b0 = clamp_mix(FB_A0 + (((ACC0 - FB_A0) * Revb.FB_ALPHA - FB_B0 * Revb.FB_X) >> 15));
-		const s32 mix_b1 = clamp_mix(FB_A1 + (((ACC1 - FB_A1) * Revb.FB_ALPHA - FB_B1 * Revb.FB_X) >> 15));
-
-		_spu2mem[mix_dest_a0] = mix_a0;
-		_spu2mem[mix_dest_a1] = mix_a1;
-		_spu2mem[mix_dest_b0] = mix_b0;
-		_spu2mem[mix_dest_b1] = mix_b1;
-
-		upbuf[ubpos] = clamp_mix( StereoOut32(
-			mix_a0 + mix_b0,	// left
-			mix_a1 + mix_b1		// right
-		) );
+		upbuf[ubpos] = ReverbVerify ?
+			ReverbStepVerify( Index, Revb, t, input_L, input_R ) :
+			ReverbStep( Revb, t, input_L, input_R );
 	}
 
 	StereoOut32 retval;
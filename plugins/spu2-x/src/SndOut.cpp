@@ -115,8 +115,12 @@ int FindOutputModuleById( const wchar_t* omodid )
 
 StereoOut32 *SndBuffer::m_buffer;
 s32 SndBuffer::m_size;
-__aligned(4) volatile s32 SndBuffer::m_rpos;
-__aligned(4) volatile s32 SndBuffer::m_wpos;
+std::atomic<s32> SndBuffer::m_rpos;
+std::atomic<s32> SndBuffer::m_wpos;
+std::atomic<u32> SndBuffer::m_samplesWritten;
+std::atomic<u32> SndBuffer::m_samplesRead;
+std::atomic<u32> SndBuffer::m_underruns;
+std::atomic<u32> SndBuffer::m_overruns;
 
 bool SndBuffer::m_underrun_freeze;
 StereoOut32* SndBuffer::sndTempBuffer = NULL;
@@ -158,6 +162,7 @@ bool SndBuffer::CheckUnderrunStatus( int& nSamples, int& quietSampleCount )
 		nSamples = data;
 		quietSampleCount = SndOutPacketSize - data;
 		m_underrun_freeze = true;
+		m_underruns.fetch_add(1, std::memory_order_relaxed);
 
 		if( SynchMode == 0 ) // TimeStrech on
 			timeStretchUnderrun();
@@ -179,7 +184,7 @@ void SndBuffer::_InitFail()
 int SndBuffer::_GetApproximateDataInBuffer()
 {
 	// WARNING: not necessarily 100% up to date by the time it's used, but it will have to do.
-	return (m_wpos + m_size - m_rpos) % m_size;
+	return (m_wpos.load(std::memory_order_acquire) + m_size - m_rpos.load(std::memory_order_acquire)) % m_size;
 }
 
 void SndBuffer::_WriteSamples_Internal(StereoOut32 *bData, int nSamples)
@@ -187,29 +192,50 @@ void SndBuffer::_WriteSamples_Internal(StereoOut32 *bData, int nSamples)
 	// WARNING: This assumes the write will NOT wrap around,
 	// and also assumes there's enough free space in the buffer.
 
-	memcpy(m_buffer + m_wpos, bData, nSamples * sizeof(StereoOut32));
-	m_wpos = (m_wpos + nSamples) % m_size;
+	const s32 wpos = m_wpos.load(std::memory_order_relaxed);
+	memcpy(m_buffer + wpos, bData, nSamples * sizeof(StereoOut32));
+	m_wpos.store((wpos + nSamples) % m_size, std::memory_order_release);
 }
 
 void SndBuffer::_DropSamples_Internal(int nSamples)
 {
-	m_rpos = (m_rpos + nSamples) % m_size;
+	m_rpos.store((m_rpos.load(std::memory_order_relaxed) + nSamples) % m_size, std::memory_order_release);
+}
+
+int SndBuffer::_GetReadSpans( int nSamples, const StereoOut32* (&span)[2], int (&count)[2] )
+{
+	nSamples = std::min( nSamples, _GetApproximateDataInBuffer() );
+
+	const s32 rpos = m_rpos.load(std::memory_order_relaxed);
+
+	span[0] = m_buffer + rpos;
+	count[0] = std::min( nSamples, m_size - rpos );
+	span[1] = m_buffer;
+	count[1] = nSamples - count[0];
+
+	return nSamples;
+}
+
+void SndBuffer::_ReleaseReadSpans( int nSamples )
+{
+	_DropSamples_Internal(nSamples);
+	m_samplesRead.fetch_add(nSamples, std::memory_order_relaxed);
 }
 
 void SndBuffer::_ReadSamples_Internal(StereoOut32 *bData, int nSamples)
 {
 	// WARNING: This assumes the read will NOT wrap around,
 	// and also assumes there's enough data in the buffer.
-	memcpy(bData, m_buffer + m_rpos, nSamples * sizeof(StereoOut32));
+	memcpy(bData, m_buffer + m_rpos.load(std::memory_order_relaxed), nSamples * sizeof(StereoOut32));
 	_DropSamples_Internal(nSamples);
 }
 
 void SndBuffer::_WriteSamples_Safe(StereoOut32 *bData, int nSamples)
 {
 	// WARNING: This code assumes there's only ONE writing process.
-	if( (m_size - m_wpos) < nSamples)
+	if( (m_size - m_wpos.load(std::memory_order_relaxed)) < nSamples)
 	{
-		int b1 = m_size - m_wpos;
+		int b1 = m_size - m_wpos.load(std::memory_order_relaxed);
 		int b2 = nSamples - b1;
 
 		_WriteSamples_Internal(bData, b1);
@@ -224,9 +250,9 @@ void SndBuffer::_WriteSamples_Safe(StereoOut32 *bData, int nSamples)
 void SndBuffer::_ReadSamples_Safe(StereoOut32* bData, int nSamples)
 {
 	// WARNING: This code assumes there's only ONE reading process.
-	if( (m_size - m_rpos) < nSamples)
+	if( (m_size - m_rpos.load(std::memory_order_relaxed)) < nSamples)
 	{
-		int b1 = m_size - m_rpos;
+		int b1 = m_size - m_rpos.load(std::memory_order_relaxed);
 		int b2 = nSamples - b1;
 
 		_ReadSamples_Internal(bData, b1);
@@ -265,35 +291,30 @@ template<typename T> void SndBuffer::ReadSamples(T* bData)
 		jASSUME( nSamples <= SndOutPacketSize );
 		
 		// WARNING: This code assumes there's only ONE reading process.
-		int b1 = m_size - m_rpos;
+		// The samples are converted straight from the ring into the driver's buffer.
+		const StereoOut32* span[2];
+		int count[2];
 
-		if(b1 > nSamples)
-			b1 = nSamples;
+		nSamples = _GetReadSpans( nSamples, span, count );
 
 		if (AdvancedVolumeControl)
 		{
-			// First part
-			for (int i = 0; i < b1; i++)
-				bData[i].AdjustFrom(m_buffer[i + m_rpos]);
-
-			// Second part
-			int b2 = nSamples - b1;
-			for (int i = 0; i < b2; i++)
-				bData[i + b1].AdjustFrom(m_buffer[i]);
+			for (int i = 0; i < count[0]; i++)
+				bData[i].AdjustFrom(span[0][i]);
+
+			for (int i = 0; i < count[1]; i++)
+				bData[i + count[0]].AdjustFrom(span[1][i]);
 		}
 		else
 		{
-			// First part
-			for (int i = 0; i < b1; i++)
-				bData[i].ResampleFrom(m_buffer[i + m_rpos]);
-
-			// Second part
-			int b2 = nSamples - b1;
-			for (int i = 0; i < b2; i++)
-				bData[i + b1].ResampleFrom(m_buffer[i]);
+			for (int i = 0; i < count[0]; i++)
+				bData[i].ResampleFrom(span[0][i]);
+
+			for (int i = 0; i < count[1]; i++)
+				bData[i + count[0]].ResampleFrom(span[1][i]);
 		}
 
-		_DropSamples_Internal(nSamples);
+		_ReleaseReadSpans(nSamples);
 	}
 
 	// If quietSamples != 0 it means we have an underrun...
@@ -341,39 +362,19 @@ void SndBuffer::_WriteSamples(StereoOut32 *bData, int nSamples)
 	int free = m_size - _GetApproximateDataInBuffer(); // -1, but the <= handles that
 	if( free <= nSamples )
 	{
-		// Disabled since the lock-free queue can't handle changing the read end from the write thread
-#if 0
 		// Buffer overrun!
-		// Dump samples from the read portion of the buffer instead of dropping
-		// the newly written stuff.
-
-		s32 comp;
-
-		if( SynchMode == 0 ) // TimeStrech on
-		{
-			comp = timeStretchOverrun();
-		}
-		else
-		{
-			// Toss half the buffer plus whatever's being written anew:
-			comp = GetAlignedBufferSize( (m_size + nSamples ) / 16 );
-			if( comp > (m_size-SndOutPacketSize) ) comp = m_size-SndOutPacketSize;
-		}
-
-		_DropSamples_Internal(comp);
+		// Only the reader may move m_rpos, so the old samples can't be dumped from here;
+		// toss this packet instead.
+		m_overruns.fetch_add(1, std::memory_order_relaxed);
 
-		if( MsgOverruns() )
-			ConLog(" * SPU2 > Overrun Compensation (%d packets tossed)\n", comp / SndOutPacketSize );
-		lastPct = 0.0;		// normalize the timestretcher
-#else
 		if( MsgOverruns() )
 			ConLog(" * SPU2 > Overrun! 1 packet tossed)\n");
 		lastPct = 0.0;		// normalize the timestretcher
 		return;
-#endif
 	}
 
 	_WriteSamples_Safe(bData, nSamples);
+	m_samplesWritten.fetch_add(nSamples, std::memory_order_relaxed);
 }
 
 void SndBuffer::Init()
@@ -388,8 +389,12 @@ void SndBuffer::Init()
 	// Buffer actually attempts to run ~50%, so allocate near double what
 	// the requested latency is:
 	
-	m_rpos = 0;
-	m_wpos = 0;
+	m_rpos.store(0);
+	m_wpos.store(0);
+	m_samplesWritten.store(0);
+	m_samplesRead.store(0);
+	m_underruns.store(0);
+	m_overruns.store(0);
 
 	try
 	{
@@ -439,6 +444,18 @@ int SndBuffer::m_dsp_progress = 0;
 int SndBuffer::m_timestretch_progress = 0;
 int SndBuffer::ssFreeze = 0;
 
+void SndBuffer::GetStats( SndBufferStats& dest )
+{
+	dest.SamplesWritten		= m_samplesWritten.load(std::memory_order_relaxed);
+	dest.SamplesRead		= m_samplesRead.load(std::memory_order_relaxed);
+	dest.Underruns			= m_underruns.load(std::memory_order_relaxed);
+	dest.Overruns			= m_overruns.load(std::memory_order_relaxed);
+	dest.BufferSize			= m_buffer ? m_size : 0;
+	dest.BufferedSamples	= m_buffer ? _GetApproximateDataInBuffer() : 0;
+	dest.LatencyMS			= dest.BufferedSamples * 1000.0f / SampleRate;
+	dest.Tempo				= eTempo;
+}
+
 void SndBuffer::ClearContents()
 {
 	SndBuffer::soundtouchClearContents();
@@ -561,6 +561,23 @@ struct Stereo51Out32
 	}
 };
 
+// Snapshot of the output buffer state, as returned by SndBuffer::GetStats.  The counters
+// are cumulative since SndBuffer::Init.  Each is an atomic updated by the thread that owns
+// the event (SPU2 thread for writes/overruns, the driver for reads/underruns), so they may
+// be a packet out of date.
+struct SndBufferStats
+{
+	s32 BufferedSamples;	// samples queued between the mixer and the output driver
+	s32 BufferSize;			// capacity of the queue, in samples
+	float LatencyMS;		// BufferedSamples expressed in milliseconds
+	float Tempo;			// current timestretch tempo (1.0 is no stretching)
+
+	u32 SamplesWritten;
+	u32 SamplesRead;
+	u32 Underruns;
+	u32 Overruns;
+};
+
 // Developer Note: This is a static class only (all static members).
 class SndBuffer
 {
@@ -581,8 +598,18 @@ private:
 	static StereoOut32 *m_buffer;
 	static s32 m_size;
 
-	static __aligned(4) volatile s32 m_rpos;
-	static __aligned(4) volatile s32 m_wpos;
+	// Single producer (the SPU2 mixer advances m_wpos) / single consumer (the output
+	// driver advances m_rpos) ring.  Positions are stored with release semantics after
+	// the samples are copied, and loaded with acquire semantics by the other side.
+	// Only the reader ever moves m_rpos, so on overrun the writer tosses the new packet.
+	static std::atomic<s32> m_rpos;
+	static std::atomic<s32> m_wpos;
+
+	// SndBufferStats counters; see there for which thread writes each one.
+	static std::atomic<u32> m_samplesWritten;
+	static std::atomic<u32> m_samplesRead;
+	static std::atomic<u32> m_underruns;
+	static std::atomic<u32> m_overruns;
 	
 	static float lastEmergencyAdj;
 	static float cTempo;
@@ -613,6 +640,12 @@ private:
 	static void _DropSamples_Internal(int nSamples);
 	static void _ReadSamples_Internal(StereoOut32 *bData, int nSamples);
 
+	// Output thread only: fills span/count with up to nSamples queued samples as at most
+	// two contiguous runs of the ring, and returns the total.  The memory stays valid until
+	// _ReleaseReadSpans consumes the samples.
+	static int _GetReadSpans( int nSamples, const StereoOut32* (&span)[2], int (&count)[2] );
+	static void _ReleaseReadSpans( int nSamples );
+
 	static int _GetApproximateDataInBuffer(); 
 	
 public:
@@ -622,6 +655,7 @@ public:
 	static void Write( const StereoOut32& Sample );
 	static s32 Test();
 	static void ClearContents();
+	static void GetStats( SndBufferStats& dest );
 
 	// Note: When using with 32 bit output buffers, the user of this function is responsible
 	// for shifting the values to where they need to be manually.  The fixed point depth of
@@ -105,8 +105,6 @@ double HighResScale;
 
 bool Running = false;
 
-#ifdef _MSC_VER
-
 int conprintf(const char* fmt, ...)
 {
 #ifdef _WIN32
@@ -129,7 +127,7 @@ int conprintf(const char* fmt, ...)
 #else
 	va_list list;
 	va_start(list, fmt);
-	int ret = vsprintf(stderr,fmt,list);
+	int ret = vfprintf(stderr,fmt,list);
 	va_end(list);
 	return ret;
 #endif
@@ -153,25 +151,19 @@ void dummy7()
 #endif
 }
 
+#ifdef _MSC_VER
+
 u64 HighResFrequency()
 {
 	u64 freq;
-#ifdef _WIN32
 	QueryPerformanceFrequency((LARGE_INTEGER*)&freq);
-#else
-	// TODO
-#endif
 	return freq;
 }
 
 u64 HighResCounter()
 {
 	u64 time;
-#ifdef _WIN32
 	QueryPerformanceCounter((LARGE_INTEGER*)&time);
-#else
-	// TODO
-#endif
 	return time;
 }
 
@@ -203,59 +195,32 @@ u32 WaitSync( u32 TargetCycle )
 	return delta;
 }
 
-#ifdef _WIN32
 BOOL WINAPI HandlerRoutine(DWORD dwCtrlType)
 {
 	Running = false;
 	return TRUE;
 }
+
 #endif
 
-#include "Windows/Dialogs.h"
-EXPORT_C_(void) s2r_replay(HWND hwnd, HINSTANCE hinst, LPSTR filename, int nCmdShow)
-{
 #ifndef ENABLE_NEW_IOPDMA_SPU2
+// Feeds the events of the replay file to the plugin, returns the number of events played.
+// In realtime mode (Windows only) the IOP clock follows the host clock; otherwise it jumps
+// straight to each event, so the file is processed as fast as the mixer can run.
+static int s2r_run(FILE* file, uptr hwnd, bool realtime)
+{
 	int events=0;
 
-	Running = true;
-
-#ifdef _WIN32
-	AllocConsole();
-	SetConsoleCtrlHandler(HandlerRoutine, TRUE);
-	
-	conprintf("Playing %s file on %x...",filename,hwnd);
-
-	if (IsWindows8OrGreater())
-	{
-		for (int n = 0; mods[n] != nullptr; ++n)
-		{
-			if (mods[n] == XAudio2_27_Out)
-			{
-				mods[n] = XAudio2Out;
-				break;
-			}
-		}
-	}
-
-#endif
-
-	// load file
-	FILE *file=fopen(filename,"rb");
-
-	if(!file)
-	{
-		conprintf("Could not open the replay file.");
-		return;
-	}
-	// if successful, init the plugin
-
 #define TryRead(dest,size,count,file) if(fread(dest,size,count,file)<count) { conprintf("Error reading from file.");  goto Finish;  /* Need to exit the while() loop and maybe also the switch */ }
 
 	TryRead(&CurrentIOPCycle,4,1,file);
 	
 	replay_mode=true;
 
-	InitWaitSync(); // Initialize the WaitSync stuff
+#ifdef _MSC_VER
+	if(realtime)
+		InitWaitSync(); // Initialize the WaitSync stuff
+#endif
 
 	SPU2init();
 	SPU2irqCallback(dummy1,dummy4,dummy7);
@@ -283,7 +248,20 @@ EXPORT_C_(void) s2r_replay(HWND hwnd, HINSTANCE hinst, LPSTR filename, int nCmdS
 
 		while(TargetCycle > CurrentIOPCycle)
 		{
-			u32 delta = WaitSync(TargetCycle);
+			u32 delta;
+
+#ifdef _MSC_VER
+			if(realtime)
+			{
+				delta = WaitSync(TargetCycle);
+			}
+			else
+#endif
+			{
+				delta = TargetCycle - CurrentIOPCycle;
+				CurrentIOPCycle = TargetCycle;
+			}
+
 			SPU2async(delta);
 		}
 		
@@ -306,26 +284,127 @@ EXPORT_C_(void) s2r_replay(HWND hwnd, HINSTANCE hinst, LPSTR filename, int nCmdS
 			break;
 		default:
 			// not implemented
-			return;
-			break;
+			goto Finish;
 		}
 		events++;
 	}
 
+#undef TryRead
+
 Finish:
 
 	//shutdown
 	SPU2close();
 	SPU2shutdown();
+
+	replay_mode=false;
+
+	return events;
+}
+
+// Plays the replay file once as fast as possible, with every sample run through both the
+// scalar and the SSE2 voice mixer and reverb, and reports any sample where the two differ.
+// Run it with each interpolation mode that needs checking.
+static void s2r_verify_file(const char* filename, uptr hwnd)
+{
+	Running = true;
+
+	FILE *file=fopen(filename,"rb");
+
+	if(!file)
+	{
+		conprintf("Could not open the replay file.");
+		return;
+	}
+
+	conprintf("Verifying voice mixer and reverb on %s (interpolation %d)...\n",filename,Interpolation);
+
+	VoiceMixVerify = true;
+	VoiceMixVerifySamples = 0;
+	VoiceMixVerifyMismatches = 0;
+
+	ReverbVerify = true;
+	ReverbVerifySamples = 0;
+	ReverbVerifyMismatches = 0;
+
+	int events = s2r_run(file, hwnd, false);
+
+	VoiceMixVerify = false;
+	ReverbVerify = false;
+
+	fclose(file);
+
+	conprintf("%d events, %llu core samples, %llu mismatches: %s\n",events,VoiceMixVerifySamples,VoiceMixVerifyMismatches,
+		VoiceMixVerifyMismatches == 0 ? "scalar and SSE2 mixers are identical" : "MISMATCH");
+	conprintf("%llu reverb steps, %llu mismatches: %s\n",ReverbVerifySamples,ReverbVerifyMismatches,
+		ReverbVerifyMismatches == 0 ? "scalar and SSE2 reverb are identical" : "MISMATCH");
+}
+#endif
+
+#ifdef _MSC_VER
+
+#include "Windows/Dialogs.h"
+EXPORT_C_(void) s2r_replay(HWND hwnd, HINSTANCE hinst, LPSTR filename, int nCmdShow)
+{
+#ifndef ENABLE_NEW_IOPDMA_SPU2
+	Running = true;
+
+	AllocConsole();
+	SetConsoleCtrlHandler(HandlerRoutine, TRUE);
+	
+	conprintf("Playing %s file on %x...",filename,hwnd);
+
+	if (IsWindows8OrGreater())
+	{
+		for (int n = 0; mods[n] != nullptr; ++n)
+		{
+			if (mods[n] == XAudio2_27_Out)
+			{
+				mods[n] = XAudio2Out;
+				break;
+			}
+		}
+	}
+
+	// load file
+	FILE *file=fopen(filename,"rb");
+
+	if(!file)
+	{
+		conprintf("Could not open the replay file.");
+		return;
+	}
+
+	int events = s2r_run(file, (uptr)hwnd, true);
+
 	fclose(file);
 
 	conprintf("Finished playing %s file (%d cycles, %d events).",filename,CurrentIOPCycle,events);
 
-#ifdef _WIN32
 	FreeConsole();
 #endif
+}
 
-	replay_mode=false;
+// rundll32 entry point, exported as SPU2verify by Spu2-X.def.
+EXPORT_C_(void) s2r_verify(HWND hwnd, HINSTANCE hinst, LPSTR filename, int nCmdShow)
+{
+#ifndef ENABLE_NEW_IOPDMA_SPU2
+	AllocConsole();
+	SetConsoleCtrlHandler(HandlerRoutine, TRUE);
+
+	s2r_verify_file(filename, (uptr)hwnd);
+
+	FreeConsole();
 #endif
 }
+
+#else
+
+EXPORT_C_(void) SPU2verify(const char* filename)
+{
+#ifndef ENABLE_NEW_IOPDMA_SPU2
+	s2r_verify_file(filename, 0);
+#endif
+}
+
 #endif
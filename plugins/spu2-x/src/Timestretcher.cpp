@@ -246,6 +246,12 @@ void SndBuffer::UpdateTempoChangeSoundTouch2()
 				(int)(data/48), (double)(100.0*bufferFullness/baseTargetFullness), (double)tempoAdjust, (double)(dynamicTargetFullness/baseTargetFullness), iters, (int)targetIPS
 				, AVERAGING_WINDOW, hys_min_ok_count, compensationDivider, gRequestStretcherReset
 				);
+
+			SndBufferStats stats;
+			GetStats(stats);
+			ConLog("queue: %d/%d samples (%.1f ms), written: %u, read: %u, underruns: %u, overruns: %u\n",
+				stats.BufferedSamples, stats.BufferSize, (double)stats.LatencyMS,
+				stats.SamplesWritten, stats.SamplesRead, stats.Underruns, stats.Overruns);
 			last=unow;
 			iters=0;
 		}
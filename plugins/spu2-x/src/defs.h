@@ -574,9 +574,14 @@ static const int pcm_BlockCount = 0x100000 / pcm_WordsPerBlock;
 // 28 samples per decoded PCM block (as stored in our cache)
 static const int pcm_DecodedSamplesPerBlock = 28;
 
+// A decoded block depends on the ADPCM predictor state the voice entered it with, so
+// entries are keyed by block address (their index) plus the Prev1/Prev2 they were
+// decoded from.
 struct PcmCacheEntry
 {
 	bool Validated;
+	s16 Prev1;
+	s16 Prev2;
 	s16 Sampledata[pcm_DecodedSamplesPerBlock];
 };
 
@@ -385,6 +385,10 @@ __forceinline void TimeUpdate(u32 cClocks)
 	else TickInterval = 768; // Reset to default, in case the user hotswitched from async to something else.
 
 	//Update Mixing Progress
+	// This stays one Mix() per tick.  Mix() can't render a block of samples without changing
+	// the output: reverb runs on Cycles parity, ADMA input is consumed a sample at a time, and
+	// voice and core outputs are written back to SPU2 RAM where the next sample reads them.
+	// Batching only the event-free ticks was tried; it still had to call Mix() per tick.
 	while(dClocks>=TickInterval)
 	{
 		if(has_to_call_irq)